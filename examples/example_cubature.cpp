@@ -0,0 +1,41 @@
+// examples/example_cubature.cpp
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include "cubature.h"
+
+int main() {
+    std::cout << std::setprecision(10);
+
+    // Funkcja Gaussa exp(-|x|^2) na kostce [-1, 1]^d, calka to (sqrt(pi) * erf(1))^d
+    auto gaussian = [](const std::vector<double>& x) {
+        double r2 = 0.0;
+        for (double v : x) r2 += v * v;
+        return std::exp(-r2);
+    };
+    const double one_dim = std::sqrt(std::acos(-1.0)) * std::erf(1.0);
+
+    for (int d : {2, 6, 16}) {
+        std::vector<double> lower(d, -1.0), upper(d, 1.0);
+        double exact = std::pow(one_dim, d);
+        std::cout << "=== Wymiar d = " << d << ", dokladna wartosc: " << exact << " ===" << std::endl;
+
+        if (d <= 3) {
+            auto tensor = numeric::cubature::tensorGaussLegendre(gaussian, lower, upper, 8);
+            std::cout << "Gauss tensorowy:  " << tensor.value << ", szac. blad: " << tensor.error_estimate
+                      << ", wywolania: " << tensor.evaluations << std::endl;
+        }
+        if (d <= 8) {
+            auto sparse = numeric::cubature::sparseGridIntegration(gaussian, lower, upper, 5);
+            std::cout << "Siatka rzadka:    " << sparse.value << ", szac. blad: " << sparse.error_estimate
+                      << ", wywolania: " << sparse.evaluations << std::endl;
+        }
+        auto qmc = numeric::cubature::sobolQuasiMonteCarlo(gaussian, lower, upper, 1 << 14, 8, 1, 4);
+        std::cout << "Sobol QMC:        " << qmc.value << ", szac. blad: " << qmc.error_estimate
+                  << ", wywolania: " << qmc.evaluations << std::endl;
+    }
+
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <cmath>
 #include "integration.h" // Nasza nowa biblioteka
 
 // Definicja funkcji wielomianowej za pomocą lambdy i przechwycenia współczynników
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <vector>
 #include <limits>
+#include <cmath>
 #include "interpolation.h" // Dołączamy naszą nową bibliotekę
 
 // ... (załóżmy, że funkcja LoadData() jest zdefiniowana tak jak wcześniej) ...
@@ -0,0 +1,279 @@
+// include/autodiff.h
+
+#ifndef AUTODIFF_H
+#define AUTODIFF_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+#include "nonlinear_equations.h"
+#include "stiff_equations.h"
+
+namespace numeric {
+namespace autodiff {
+
+    /**
+     * @brief Liczba dualna do rozniczkowania w przod: wartosc i N pochodnych kierunkowych.
+     * Dual<1> daje pochodna funkcji skalarnej w jednym wywolaniu, Dual<N> - N kolumn jakobianu naraz.
+     * Funkcje uzytkownika musza byc szablonami (np. lambda z parametrem auto) i wolac funkcje matematyczne
+     * bez kwalifikacji (using std::sin; sin(x)), zeby dla Dual wybrane zostaly przeciazenia z tej przestrzeni nazw.
+     */
+    template <std::size_t N = 1>
+    struct Dual {
+        double value = 0.0;
+        std::array<double, N> grad{};
+
+        Dual() = default;
+        Dual(double v) : value(v) {} // Stala - zerowe pochodne (niejawna konwersja jest zamierzona)
+        Dual(double v, const std::array<double, N>& g) : value(v), grad(g) {}
+
+        /**
+         * @brief Zmienna niezalezna o wartosci v rozniczkowana w kierunku direction (< N).
+         */
+        static Dual variable(double v, std::size_t direction = 0) {
+            Dual d(v);
+            d.grad[direction] = 1.0;
+            return d;
+        }
+
+        Dual& operator+=(const Dual& o) {
+            value += o.value;
+            for (std::size_t k = 0; k < N; ++k) grad[k] += o.grad[k];
+            return *this;
+        }
+        Dual& operator-=(const Dual& o) {
+            value -= o.value;
+            for (std::size_t k = 0; k < N; ++k) grad[k] -= o.grad[k];
+            return *this;
+        }
+        Dual& operator*=(const Dual& o) {
+            for (std::size_t k = 0; k < N; ++k) grad[k] = grad[k] * o.value + value * o.grad[k];
+            value *= o.value;
+            return *this;
+        }
+        Dual& operator/=(const Dual& o) {
+            const double inv = 1.0 / o.value;
+            value *= inv;
+            for (std::size_t k = 0; k < N; ++k) grad[k] = (grad[k] - value * o.grad[k]) * inv;
+            return *this;
+        }
+    };
+
+    namespace detail {
+        // Regula lancuchowa: g(u) z g'(u) = slope
+        template <std::size_t N>
+        Dual<N> chain(const Dual<N>& u, double value, double slope) {
+            Dual<N> r(value);
+            for (std::size_t k = 0; k < N; ++k) r.grad[k] = slope * u.grad[k];
+            return r;
+        }
+    } // namespace detail
+
+    // === Arytmetyka (operandy double sa promowane do stalych) ===
+
+    template <std::size_t N> Dual<N> operator+(Dual<N> a, const Dual<N>& b) { return a += b; }
+    template <std::size_t N> Dual<N> operator-(Dual<N> a, const Dual<N>& b) { return a -= b; }
+    template <std::size_t N> Dual<N> operator*(Dual<N> a, const Dual<N>& b) { return a *= b; }
+    template <std::size_t N> Dual<N> operator/(Dual<N> a, const Dual<N>& b) { return a /= b; }
+    template <std::size_t N> Dual<N> operator+(Dual<N> a, double b) { a.value += b; return a; }
+    template <std::size_t N> Dual<N> operator+(double a, Dual<N> b) { b.value += a; return b; }
+    template <std::size_t N> Dual<N> operator-(Dual<N> a, double b) { a.value -= b; return a; }
+    template <std::size_t N> Dual<N> operator-(double a, const Dual<N>& b) { return Dual<N>(a) -= b; }
+    template <std::size_t N> Dual<N> operator*(Dual<N> a, double b) {
+        a.value *= b;
+        for (auto& g : a.grad) g *= b;
+        return a;
+    }
+    template <std::size_t N> Dual<N> operator*(double a, const Dual<N>& b) { return b * a; }
+    template <std::size_t N> Dual<N> operator/(const Dual<N>& a, double b) { return a * (1.0 / b); }
+    template <std::size_t N> Dual<N> operator/(double a, const Dual<N>& b) { return Dual<N>(a) /= b; }
+    template <std::size_t N> Dual<N> operator-(const Dual<N>& a) { return a * -1.0; }
+    template <std::size_t N> Dual<N> operator+(const Dual<N>& a) { return a; }
+
+    // Porownania wedlug wartosci (rozgalezienia w funkcji uzytkownika)
+    template <std::size_t N> bool operator<(const Dual<N>& a, const Dual<N>& b) { return a.value < b.value; }
+    template <std::size_t N> bool operator>(const Dual<N>& a, const Dual<N>& b) { return a.value > b.value; }
+    template <std::size_t N> bool operator<=(const Dual<N>& a, const Dual<N>& b) { return a.value <= b.value; }
+    template <std::size_t N> bool operator>=(const Dual<N>& a, const Dual<N>& b) { return a.value >= b.value; }
+    template <std::size_t N> bool operator==(const Dual<N>& a, const Dual<N>& b) { return a.value == b.value; }
+    template <std::size_t N> bool operator!=(const Dual<N>& a, const Dual<N>& b) { return a.value != b.value; }
+    template <std::size_t N> bool operator<(const Dual<N>& a, double b) { return a.value < b; }
+    template <std::size_t N> bool operator>(const Dual<N>& a, double b) { return a.value > b; }
+    template <std::size_t N> bool operator<=(const Dual<N>& a, double b) { return a.value <= b; }
+    template <std::size_t N> bool operator>=(const Dual<N>& a, double b) { return a.value >= b; }
+    template <std::size_t N> bool operator<(double a, const Dual<N>& b) { return a < b.value; }
+    template <std::size_t N> bool operator>(double a, const Dual<N>& b) { return a > b.value; }
+    template <std::size_t N> bool operator<=(double a, const Dual<N>& b) { return a <= b.value; }
+    template <std::size_t N> bool operator>=(double a, const Dual<N>& b) { return a >= b.value; }
+    template <std::size_t N> bool operator==(const Dual<N>& a, double b) { return a.value == b; }
+    template <std::size_t N> bool operator!=(const Dual<N>& a, double b) { return a.value != b; }
+    template <std::size_t N> bool operator==(double a, const Dual<N>& b) { return a == b.value; }
+    template <std::size_t N> bool operator!=(double a, const Dual<N>& b) { return a != b.value; }
+
+    // === Funkcje elementarne ===
+
+    template <std::size_t N> Dual<N> sin(const Dual<N>& u) { return detail::chain(u, std::sin(u.value), std::cos(u.value)); }
+    template <std::size_t N> Dual<N> cos(const Dual<N>& u) { return detail::chain(u, std::cos(u.value), -std::sin(u.value)); }
+    template <std::size_t N> Dual<N> tan(const Dual<N>& u) {
+        const double t = std::tan(u.value);
+        return detail::chain(u, t, 1.0 + t * t);
+    }
+    template <std::size_t N> Dual<N> asin(const Dual<N>& u) {
+        return detail::chain(u, std::asin(u.value), 1.0 / std::sqrt(1.0 - u.value * u.value));
+    }
+    template <std::size_t N> Dual<N> acos(const Dual<N>& u) {
+        return detail::chain(u, std::acos(u.value), -1.0 / std::sqrt(1.0 - u.value * u.value));
+    }
+    template <std::size_t N> Dual<N> atan(const Dual<N>& u) {
+        return detail::chain(u, std::atan(u.value), 1.0 / (1.0 + u.value * u.value));
+    }
+    template <std::size_t N> Dual<N> exp(const Dual<N>& u) {
+        const double e = std::exp(u.value);
+        return detail::chain(u, e, e);
+    }
+    template <std::size_t N> Dual<N> log(const Dual<N>& u) { return detail::chain(u, std::log(u.value), 1.0 / u.value); }
+    template <std::size_t N> Dual<N> sqrt(const Dual<N>& u) {
+        const double s = std::sqrt(u.value);
+        return detail::chain(u, s, 0.5 / s);
+    }
+    template <std::size_t N> Dual<N> sinh(const Dual<N>& u) { return detail::chain(u, std::sinh(u.value), std::cosh(u.value)); }
+    template <std::size_t N> Dual<N> cosh(const Dual<N>& u) { return detail::chain(u, std::cosh(u.value), std::sinh(u.value)); }
+    template <std::size_t N> Dual<N> tanh(const Dual<N>& u) {
+        const double t = std::tanh(u.value);
+        return detail::chain(u, t, 1.0 - t * t);
+    }
+    template <std::size_t N> Dual<N> abs(const Dual<N>& u) { return u.value < 0 ? -u : u; }
+    template <std::size_t N> Dual<N> pow(const Dual<N>& u, double p) {
+        return detail::chain(u, std::pow(u.value, p), p * std::pow(u.value, p - 1.0));
+    }
+    template <std::size_t N> Dual<N> pow(const Dual<N>& u, const Dual<N>& v) { return exp(v * log(u)); }
+    template <std::size_t N> Dual<N> pow(double a, const Dual<N>& v) {
+        const double r = std::pow(a, v.value);
+        return detail::chain(v, r, r * std::log(a));
+    }
+
+    // === Pochodne i jakobiany ===
+
+    /**
+     * @brief Wartosc i pochodna funkcji skalarnej w x z jednego wywolania f(Dual<1>).
+     */
+    template <typename F>
+    Dual<1> derivative(F&& f, double x) {
+        return f(Dual<1>::variable(x));
+    }
+
+    /**
+     * @brief Wypelnia J[i][j] = d F_i / d x_j (J ma juz m wierszy po x.size() kolumn) oraz fx = F(x).
+     * Jedno wywolanie F(std::vector<Dual<N>>, std::vector<Dual<N>>&) daje N kolumn, wiec caly jakobian
+     * kosztuje ceil(n / N) wywolan.
+     * @param F Szablon void(const std::vector<T>& x, std::vector<T>& fx) dla T = double i T = Dual<N>.
+     * @throws std::invalid_argument jesli x lub J jest puste albo wiersze J maja zly rozmiar.
+     */
+    template <std::size_t N = 8, typename F>
+    void jacobian(F&& f, const std::vector<double>& x, std::vector<std::vector<double>>& J, std::vector<double>& fx) {
+        static_assert(N > 0, "Liczba kierunkow N musi byc dodatnia.");
+        const std::size_t n = x.size();
+        const std::size_t m = J.size();
+        if (n == 0 || m == 0) {
+            throw std::invalid_argument("Wektor x i macierz J nie moga byc puste.");
+        }
+        for (const auto& row : J) {
+            if (row.size() != n) {
+                throw std::invalid_argument("Wiersze macierzy J musza miec rozmiar x.");
+            }
+        }
+        std::vector<Dual<N>> xd(n), fd(m);
+        fx.resize(m);
+        for (std::size_t first = 0; first < n; first += N) {
+            const std::size_t count = std::min(N, n - first);
+            for (std::size_t i = 0; i < n; ++i) {
+                xd[i] = Dual<N>(x[i]);
+                if (i >= first && i < first + count) {
+                    xd[i].grad[i - first] = 1.0;
+                }
+            }
+            f(static_cast<const std::vector<Dual<N>>&>(xd), fd);
+            for (std::size_t r = 0; r < m; ++r) {
+                fx[r] = fd[r].value;
+                for (std::size_t k = 0; k < count; ++k) {
+                    J[r][first + k] = fd[r].grad[k];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Jakobian dla nonlinear::solveSystem (SystemSolverOptions::jacobian) liczony w przod.
+     */
+    template <std::size_t N = 8, typename F>
+    nonlinear::SystemJacobian systemJacobian(F f) {
+        return [f](const std::vector<double>& x, std::vector<std::vector<double>>& J) mutable {
+            std::vector<double> fx;
+            jacobian<N>(f, x, J, fx);
+        };
+    }
+
+    /**
+     * @brief Jakobian prawej strony dla metod niejawnych (ode::StiffOptions::jacobian) liczony w przod.
+     * @param f Szablon void(double x, const std::vector<T>& y, std::vector<T>& dydx).
+     */
+    template <std::size_t N = 8, typename F>
+    ode::JacobianFunction odeJacobian(F f) {
+        return [f](double x, const std::vector<double>& y, std::vector<std::vector<double>>& J) mutable {
+            std::vector<double> fy;
+            jacobian<N>([&f, x](const auto& yy, auto& dydx) { f(x, yy, dydx); }, y, J, fy);
+        };
+    }
+
+    /**
+     * @brief Metoda Newtona z dokladna pochodna: jedno wywolanie f(Dual<1>) na iteracje daje f i f'.
+     * Kryteria jak w nonlinear::newtonMethod.
+     * @param f Szablon T(T) dla T = Dual<1>.
+     * @throws std::invalid_argument jesli epsilon <= 0 lub max_iter <= 0.
+     */
+    template <typename F>
+    std::optional<double> newtonMethod(F&& f, double x0, double epsilon = 1e-7, int max_iter = 100) {
+        if (epsilon <= 0 || max_iter <= 0) {
+            throw std::invalid_argument("Nieprawidlowe argumenty dla metody Newtona.");
+        }
+        double x = x0;
+        for (int i = 0; i < max_iter; ++i) {
+            const Dual<1> fx = f(Dual<1>::variable(x));
+            if (std::abs(fx.value) < epsilon) {
+                return x;
+            }
+            if (std::abs(fx.grad[0]) < std::numeric_limits<double>::epsilon()) {
+                return std::nullopt; // Pochodna bliska zeru
+            }
+            const double x_next = x - fx.value / fx.grad[0];
+            if (std::abs(x_next - x) < epsilon) {
+                return x_next;
+            }
+            x = x_next;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief nonlinear::solveSystem z jakobianem liczonym w przod zamiast roznic skonczonych
+     * (options.jacobian jest zastepowany).
+     * @param F Szablon void(const std::vector<T>& x, std::vector<T>& fx) dla T = double i T = Dual<N>.
+     */
+    template <std::size_t N = 8, typename F>
+    std::optional<nonlinear::SystemRootResult> solveSystem(F f, const std::vector<double>& x0,
+                                                           nonlinear::SystemSolverOptions options =
+                                                               nonlinear::SystemSolverOptions()) {
+        options.jacobian = systemJacobian<N>(f);
+        return nonlinear::solveSystem(
+            [f](const std::vector<double>& x, std::vector<double>& fx) mutable { f(x, fx); }, x0, options);
+    }
+
+} // namespace autodiff
+} // namespace numeric
+
+#endif // AUTODIFF_H
@@ -0,0 +1,66 @@
+// include/cubature.h
+
+#ifndef CUBATURE_H
+#define CUBATURE_H
+
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <stdexcept>
+
+namespace numeric {
+namespace cubature {
+
+    using MultiFunction = std::function<double(const std::vector<double>& x)>;
+
+    /**
+     * @brief Wynik calkowania wielowymiarowego: wartosc, oszacowanie bledu i liczba wywolan f.
+     */
+    struct CubatureResult {
+        double value;
+        double error_estimate;
+        long long evaluations;
+    };
+
+    /**
+     * @brief Oblicza calke po prostopadloscianie iloczynem tensorowym kwadratur Gaussa-Legendre'a.
+     * Koszt rosnie jak nodes^d, wiec metoda jest przeznaczona dla malych wymiarow.
+     * Blad szacowany jest przez porownanie z regula rzedu nodes - 1.
+     * @param f Funkcja do calkowania.
+     * @param lower Dolne granice w kazdym wymiarze.
+     * @param upper Gorne granice w kazdym wymiarze.
+     * @param nodes Liczba wezlow w kazdym wymiarze (co najmniej 2).
+     * @throws std::invalid_argument jesli f jest pusta, granice maja rozne rozmiary lub nodes < 2.
+     */
+    CubatureResult tensorGaussLegendre(const MultiFunction& f, const std::vector<double>& lower,
+                                       const std::vector<double>& upper, int nodes);
+
+    /**
+     * @brief Oblicza calke metoda siatek rzadkich Smolyaka opartych na zagniezdzonych regulach Clenshawa-Curtisa.
+     * Kazdy punkt siatki jest liczony raz, takze przy wyznaczaniu oszacowania bledu
+     * (roznica z poziomem level - 1, ktorego punkty sa podzbiorem punktow poziomu level).
+     * @param level Poziom siatki (od 1 do 12); poziom 0 to pojedynczy punkt srodkowy.
+     * @throws std::invalid_argument jesli f jest pusta, granice maja rozne rozmiary lub level poza zakresem.
+     */
+    CubatureResult sparseGridIntegration(const MultiFunction& f, const std::vector<double>& lower,
+                                         const std::vector<double>& upper, int level);
+
+    /**
+     * @brief Oblicza calke metoda quasi-Monte Carlo z ciagiem Sobola (wymiar do 21).
+     * Kazda replika uzywa niezaleznego skramblowania (losowa macierz Matouska i przesuniecie cyfrowe),
+     * a blad jest szacowany z rozrzutu miedzy replikami. Repliki moga byc liczone wspolbieznie -
+     * przy threads > 1 funkcja f musi byc bezpieczna watkowo. Wyjatek rzucony przez f jest przekazywany wywolujacemu.
+     * @param samples Liczba punktow w jednej replice.
+     * @param replicates Liczba niezaleznych replik (co najmniej 2).
+     * @param seed Ziarno generatora skramblowania.
+     * @param threads Liczba watkow liczacych repliki.
+     * @throws std::invalid_argument przy nieprawidlowych argumentach.
+     */
+    CubatureResult sobolQuasiMonteCarlo(const MultiFunction& f, const std::vector<double>& lower,
+                                        const std::vector<double>& upper, long long samples,
+                                        int replicates = 8, std::uint64_t seed = 0, int threads = 1);
+
+} // namespace cubature
+} // namespace numeric
+
+#endif // CUBATURE_H
@@ -4,7 +4,9 @@
 #define DIFFERENTIAL_EQUATIONS_H
 
 #include <vector>
+#include <cstddef>
 #include <functional>
+#include <optional>
 #include <stdexcept> // Potrzebne dla std::invalid_argument
 
 namespace numeric {
@@ -45,6 +47,358 @@ namespace ode {
     std::vector<SolutionPoint> rungeKutta4(
         const OdeFunction& f, double x0, double y0, double h, double x_end);
 
+    // === Obserwatorzy: wyniki przekazywane na biezaco zamiast gromadzenia calej trajektorii ===
+
+    /**
+     * @brief Wywolywany dla kazdego punktu rozwiazania (x, y) - w tej samej kolejnosci,
+     * w jakiej wersje zwracajace wektor zapisuja punkty.
+     */
+    using Observer = std::function<void(double x, double y)>;
+
+    /**
+     * @brief Wersje metod przekazujace kolejne punkty do obserwatora; pamiec nie rosnie z liczba krokow.
+     * @throws std::invalid_argument jak wersje zwracajace wektor oraz gdy obserwator jest pusty.
+     */
+    void eulerMethod(const OdeFunction& f, double x0, double y0, double h, double x_end, const Observer& observer);
+    void heunMethod(const OdeFunction& f, double x0, double y0, double h, double x_end, const Observer& observer);
+    void midpointMethod(const OdeFunction& f, double x0, double y0, double h, double x_end, const Observer& observer);
+    void rungeKutta4(const OdeFunction& f, double x0, double y0, double h, double x_end, const Observer& observer);
+
+    /**
+     * @brief Zapamietuje tylko ostatni punkt rozwiazania.
+     */
+    Observer finalStateObserver(SolutionPoint& last);
+
+    /**
+     * @brief Zapisuje co stride-ty punkt (zaczynajac od pierwszego).
+     * @throws std::invalid_argument jesli stride == 0.
+     */
+    Observer strideObserver(std::size_t stride, std::vector<SolutionPoint>& out);
+
+    /**
+     * @brief Zapisuje rozwiazanie w zadanych punktach x, interpolujac kubicznie (Hermite) miedzy krokami.
+     * Pochodne liczone sa z f tylko dla krokow zawierajacych zadane punkty.
+     * Punkty spoza zakresu rozwiazania sa pomijane.
+     */
+    Observer outputAtObserver(const OdeFunction& f, std::vector<double> points, std::vector<SolutionPoint>& out);
+
+    // === Uklady rownan (stan wektorowy) ===
+
+    /**
+     * @brief Prawa strona ukladu: zapisuje dy/dx do bufora dydx (o rozmiarze y, przygotowanego przez solver).
+     * Funkcja nie powinna zmieniac rozmiaru dydx.
+     */
+    using OdeSystemFunction = std::function<void(double x, const std::vector<double>& y, std::vector<double>& dydx)>;
+
+    /**
+     * @brief Trajektoria ukladu: x[i] i stan y[i * dimension + k] (wiersz na punkt, jeden ciagly bufor).
+     */
+    struct SystemSolution {
+        std::size_t dimension = 0;
+        std::vector<double> x;
+        std::vector<double> y;
+
+        std::size_t size() const { return x.size(); }
+        const double* state(std::size_t i) const { return y.data() + i * dimension; }
+    };
+
+    /**
+     * @brief Obserwator ukladu: wywolywany dla kazdego punktu rozwiazania.
+     */
+    using SystemObserver = std::function<void(double x, const std::vector<double>& y)>;
+
+    struct SystemSolutionPoint {
+        double x = 0.0;
+        std::vector<double> y;
+    };
+
+    /**
+     * @brief Rozwiazuje uklad rownan metoda Eulera w punktach x0 + i*h <= x_end.
+     * Wektory etapow i wynik sa alokowane raz przed petla, wiec sama petla nie alokuje pamieci.
+     * @throws std::invalid_argument jesli krok h jest niedodatni, x_end < x0, y0 jest pusty lub funkcja f jest nieprawidlowa.
+     */
+    SystemSolution eulerSystem(
+        const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end);
+
+    /**
+     * @brief Rozwiazuje uklad rownan metoda Heuna (jak eulerSystem).
+     */
+    SystemSolution heunSystem(
+        const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end);
+
+    /**
+     * @brief Rozwiazuje uklad rownan metoda punktu srodkowego (jak eulerSystem).
+     */
+    SystemSolution midpointSystem(
+        const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end);
+
+    /**
+     * @brief Rozwiazuje uklad rownan metoda Rungego-Kutty 4. rzedu (jak eulerSystem).
+     */
+    SystemSolution rungeKutta4System(
+        const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end);
+
+    /**
+     * @brief Wersje ukladowe przekazujace kolejne punkty do obserwatora (bez gromadzenia trajektorii).
+     * @throws std::invalid_argument jak wersje zwracajace SystemSolution oraz gdy obserwator jest pusty.
+     */
+    void eulerSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                     const SystemObserver& observer);
+    void heunSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                    const SystemObserver& observer);
+    void midpointSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                        const SystemObserver& observer);
+    void rungeKutta4System(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                           const SystemObserver& observer);
+
+    /**
+     * @brief Obserwatorzy ukladowi - odpowiedniki wersji skalarnych.
+     */
+    SystemObserver finalStateObserver(SystemSolutionPoint& last);
+    SystemObserver strideObserver(std::size_t stride, SystemSolution& out);
+    SystemObserver outputAtObserver(const OdeSystemFunction& f, std::vector<double> points, SystemSolution& out);
+
+    // === Zdarzenia (g(x, y) = 0) ===
+
+    enum class EventDirection {
+        Any,     // Kazda zmiana znaku g
+        Rising,  // Tylko przejscia g z ujemnych na dodatnie
+        Falling  // Tylko przejscia g z dodatnich na ujemne
+    };
+
+    using EventFunction = std::function<double(double x, const std::vector<double>& y)>;
+
+    /**
+     * @brief Zdarzenie sprawdzane po kazdym kroku. Zdarzenie terminalne konczy calkowanie w punkcie zdarzenia.
+     */
+    struct OdeEvent {
+        EventFunction g;
+        bool terminal = false;
+        EventDirection direction = EventDirection::Any;
+    };
+
+    /**
+     * @brief Wykryte zdarzenie: indeks w wektorze zdarzen, punkt przejscia i stan w tym punkcie.
+     */
+    struct EventRecord {
+        std::size_t index = 0;
+        double x = 0.0;
+        std::vector<double> y;
+    };
+
+    struct EventSolution {
+        SystemSolution trajectory;       // Punkty krokow; po zdarzeniu terminalnym ostatni punkt to punkt zdarzenia
+        std::vector<EventRecord> events; // W kolejnosci rosnacego x
+        bool terminated = false;
+    };
+
+    /**
+     * @brief Rozwiazuje uklad metoda RK4 o stalym kroku, sprawdzajac zdarzenia po kazdym kroku.
+     * Zmiana znaku g w kroku jest lokalizowana bisekcja (modul nonlinear) na kubicznym interpolancie Hermite'a kroku,
+     * ktory kosztuje jedno dodatkowe wywolanie f tylko w krokach ze zmiana znaku.
+     * @param event_tol Dokladnosc polozenia zdarzenia.
+     * @throws std::invalid_argument jak rungeKutta4System oraz gdy ktoras funkcja g jest pusta lub event_tol <= 0.
+     */
+    EventSolution rungeKutta4Events(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h,
+                                    double x_end, const std::vector<OdeEvent>& events, double event_tol = 1e-12);
+
+    // === Metody adaptacyjne (zagniezdzone pary Rungego-Kutty) ===
+
+    /**
+     * @brief Ustawienia metod adaptacyjnych.
+     * Blad lokalny skladowej i jest porownywany z abs_tol + rel_tol * |y_i|.
+     * initial_step <= 0 oznacza automatyczny dobor kroku, max_step <= 0 brak ograniczenia.
+     */
+    struct AdaptiveOptions {
+        double abs_tol = 1e-8;
+        double rel_tol = 1e-8;
+        double initial_step = 0.0;
+        double max_step = 0.0;
+        long long max_steps = 1000000;
+        bool dense_output = true;
+    };
+
+    /**
+     * @brief Rozwiazanie ciagle: interpolant kazdego zaakceptowanego kroku (4. rzedu dla Dormanda-Prince'a,
+     * Hermite'a 3. rzedu dla Bogackiego-Shampine'a), pozwalajacy probkowac rozwiazanie w dowolnym x.
+     */
+    class DenseOutput {
+    public:
+        std::size_t dimension() const { return dimension_; }
+        bool empty() const { return x_.size() < 2; }
+        double xBegin() const { return x_.front(); }
+        double xEnd() const { return x_.back(); }
+
+        /**
+         * @brief Zapisuje do y (o rozmiarze dimension()) przyblizone rozwiazanie w punkcie x.
+         * @throws std::invalid_argument jesli x lezy poza [xBegin(), xEnd()] lub brak danych.
+         */
+        void evaluate(double x, std::vector<double>& y) const;
+        std::vector<double> operator()(double x) const;
+
+        // Uzywane przez solvery: dodaje krok od ostatniej granicy do x_next o wspolczynnikach r (5 * dimension wartosci)
+        void appendStep(double x_next, const double* r);
+        void reset(std::size_t dimension, double x0);
+
+    private:
+        std::size_t dimension_ = 0;
+        std::vector<double> x_;      // Granice krokow
+        std::vector<double> coeffs_; // 5 * dimension wspolczynnikow na krok
+    };
+
+    struct AdaptiveSolution {
+        SystemSolution steps;         // Punkty zaakceptowanych krokow
+        DenseOutput dense;            // Puste, gdy options.dense_output == false
+        long long rhs_evaluations = 0;
+        long long accepted_steps = 0;
+        long long rejected_steps = 0;
+        std::vector<EventRecord> events; // Tylko dla dormandPrince45Events
+        bool terminated = false;
+    };
+
+    /**
+     * @brief Rozwiazuje uklad metoda Dormanda-Prince'a 5(4) z kontrola kroku PI i ponownym uzyciem
+     * ostatniego etapu (FSAL), zwykle 6 wywolan f na zaakceptowany krok.
+     * @return std::optional<AdaptiveSolution> lub pusty, gdy przekroczono max_steps albo krok zmalal ponizej precyzji.
+     * @throws std::invalid_argument jesli argumenty sa nieprawidlowe (x_end < x0, tolerancje niedodatnie, ...).
+     */
+    std::optional<AdaptiveSolution> dormandPrince45(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                                   double x_end, const AdaptiveOptions& options = AdaptiveOptions());
+
+    /**
+     * @brief Rozwiazuje uklad metoda Bogackiego-Shampine'a 3(2) z FSAL (3 wywolania f na krok); jak dormandPrince45.
+     */
+    std::optional<AdaptiveSolution> bogackiShampine32(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                                     double x_end, const AdaptiveOptions& options = AdaptiveOptions());
+
+    /**
+     * @brief Metoda Dormanda-Prince'a 5(4) ze zdarzeniami lokalizowanymi na interpolancie 4. rzedu kazdego kroku
+     * (bez dodatkowych wywolan f). Po zdarzeniu terminalnym ostatni krok i rozwiazanie ciagle koncza sie w punkcie zdarzenia.
+     * @throws std::invalid_argument jak dormandPrince45 oraz gdy ktoras funkcja g jest pusta lub event_tol <= 0.
+     */
+    std::optional<AdaptiveSolution> dormandPrince45Events(const OdeSystemFunction& f, double x0,
+                                                         const std::vector<double>& y0, double x_end,
+                                                         const std::vector<OdeEvent>& events,
+                                                         const AdaptiveOptions& options = AdaptiveOptions(),
+                                                         double event_tol = 1e-12);
+
+    // === Metody wielokrokowe ===
+
+    /**
+     * @brief Rozwiazuje uklad metoda predyktor-korektor Adamsa-Bashfortha-Moultona rzedu order (2-5) w trybie PECE
+     * w punktach x0 + i*h <= x_end. Po starcie (order - 1 krokow RK4) kazdy krok kosztuje dwa wywolania f.
+     * @throws std::invalid_argument jak rungeKutta4System oraz gdy order jest poza [2, 5].
+     */
+    SystemSolution adamsBashforthMoulton(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                         double h, double x_end, int order = 4);
+    void adamsBashforthMoulton(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h,
+                               double x_end, int order, const SystemObserver& observer);
+
+    /**
+     * @brief Wersja Adamsa-Bashfortha-Moultona ze zmiennym krokiem: blad lokalny szacowany jest roznica
+     * predyktora i korektora (Milne). Przy odrzuceniu kroku lub jego podwojeniu historia jest budowana od nowa
+     * krokami pary Dormanda-Prince'a 5(4), ktore tez sa odrzucane przy zbyt duzym bledzie, wiec metoda oplaca sie
+     * dla dlugich, gladkich rozwiazan. Rozwiazanie ciagle to interpolant Hermite'a.
+     * @return std::optional<AdaptiveSolution> lub pusty, gdy przekroczono max_steps albo krok zmalal ponizej precyzji.
+     * @throws std::invalid_argument jak dormandPrince45 oraz gdy order jest poza [2, 5].
+     */
+    std::optional<AdaptiveSolution> adamsBashforthMoultonAdaptive(const OdeSystemFunction& f, double x0,
+                                                                 const std::vector<double>& y0, double x_end,
+                                                                 int order = 4,
+                                                                 const AdaptiveOptions& options = AdaptiveOptions());
+
+    // === Calkowanie rownolegle w czasie (Parareal) ===
+
+    /**
+     * @brief Propagator: przesuwa stan y z x_from do x_to w miejscu.
+     * Parareal wywoluje propagator fine wspolbieznie, wiec nie moze on wspoldzielic stanu miedzy wywolaniami.
+     */
+    using Propagator = std::function<void(double x_from, double x_to, std::vector<double>& y)>;
+
+    /**
+     * @brief Propagatory z metod biblioteki: steps krokow stalej dlugosci na kazdy przedzial
+     * lub metoda Dormanda-Prince'a (rzuca std::runtime_error, gdy nie osiagnie x_to).
+     * @throws std::invalid_argument jesli f jest pusta lub steps <= 0.
+     */
+    Propagator eulerPropagator(const OdeSystemFunction& f, int steps);
+    Propagator rungeKutta4Propagator(const OdeSystemFunction& f, int steps);
+    Propagator dormandPrince45Propagator(const OdeSystemFunction& f, const AdaptiveOptions& options = AdaptiveOptions());
+
+    struct PararealOptions {
+        int slices = 16;          // Liczba przedzialow czasu
+        int threads = 1;          // Watki liczace propagator fine
+        int max_iterations = 0;   // <= 0 oznacza slices (wtedy wynik jest rowny sekwencyjnemu fine)
+        double tol = 1e-10;       // Zbieznosc: max |U_k - U_{k-1}| / (1 + |U_k|) na granicach przedzialow
+    };
+
+    struct PararealResult {
+        SystemSolution boundaries;        // Stany na granicach przedzialow (slices + 1 punktow)
+        int iterations = 0;
+        bool converged = false;
+        double elapsed_seconds = 0.0;     // Czas calego algorytmu
+        double serial_fine_seconds = 0.0; // Zmierzony czas propagatora fine na wszystkich przedzialach (jeden przebieg)
+        double speedup = 0.0;             // serial_fine_seconds / elapsed_seconds
+    };
+
+    /**
+     * @brief Rozwiazuje uklad algorytmem Parareal: tani propagator coarse przebiega sekwencyjnie,
+     * a dokladny fine jest liczony na wszystkich przedzialach rownolegle; poprawki
+     * U_{n+1} = G(U_n^k) + F(U_n^{k-1}) - G(U_n^{k-1}) sa iterowane do zbieznosci.
+     * Po k iteracjach pierwszych k przedzialow jest juz dokladnych i nie jest liczonych ponownie.
+     * @throws std::invalid_argument przy pustych propagatorach, x_end <= x0, slices <= 0, threads <= 0 lub tol < 0.
+     */
+    PararealResult parareal(const Propagator& coarse, const Propagator& fine, double x0, const std::vector<double>& y0,
+                            double x_end, const PararealOptions& options = PararealOptions());
+
+    // === Zespoly trajektorii (wiele warunkow poczatkowych) ===
+
+    /**
+     * @brief Prawa strona dla bloku czlonkow zespolu w ukladzie SoA: skladowa k czlonka m to y[k * count + m].
+     * Petla po m w ciele funkcji przebiega po ciaglej pamieci, wiec kompilator moze ja zwektoryzowac.
+     */
+    using EnsembleFunction = std::function<void(double x, const double* y, double* dydx, std::size_t count)>;
+
+    /**
+     * @brief Obserwator zespolu: otrzymuje stan bloku czlonkow [first_member, first_member + count)
+     * w ukladzie SoA (y[k * count + m]). Przy threads > 1 jest wywolywany wspolbieznie dla roznych blokow.
+     */
+    using EnsembleObserver = std::function<void(double x, const double* y, std::size_t first_member, std::size_t count)>;
+
+    /**
+     * @brief Stan zespolu w ukladzie SoA: skladowa k czlonka m to y[k * members + m].
+     */
+    struct EnsembleState {
+        std::size_t dimension = 0;
+        std::size_t members = 0;
+        std::vector<double> y;
+
+        EnsembleState() = default;
+        EnsembleState(std::size_t dimension, std::size_t members)
+            : dimension(dimension), members(members), y(dimension * members, 0.0) {}
+
+        double& at(std::size_t member, std::size_t component) { return y[component * members + member]; }
+        double at(std::size_t member, std::size_t component) const { return y[component * members + member]; }
+    };
+
+    /**
+     * @brief Rozwiazuje ten sam uklad dla wszystkich czlonkow zespolu metoda RK4 o stalym kroku.
+     * Czlonkowie sa dzieleni na bloki calkowane krokami w jednym rytmie (jedno wywolanie f na etap dla calego bloku),
+     * a bloki sa rozdzielane miedzy watki. Przy threads > 1 funkcja f musi byc bezpieczna watkowo.
+     * @param initial Stany poczatkowe wszystkich czlonkow.
+     * @param threads Liczba watkow.
+     * @return Stany koncowe w punkcie x0 + n*h <= x_end.
+     * @throws std::invalid_argument przy nieprawidlowych argumentach (takze gdy initial.y ma zly rozmiar).
+     */
+    EnsembleState rungeKutta4Ensemble(const EnsembleFunction& f, double x0, const EnsembleState& initial,
+                                      double h, double x_end, int threads = 1);
+
+    /**
+     * @brief Wersja z obserwatorem wywolywanym dla kazdego bloku w x0 i po kazdym kroku.
+     * Zwraca stany koncowe jak wersja bez obserwatora.
+     */
+    EnsembleState rungeKutta4Ensemble(const EnsembleFunction& f, double x0, const EnsembleState& initial,
+                                      double h, double x_end, int threads, const EnsembleObserver& observer);
+
 } // namespace ode
 } // namespace numeric
 
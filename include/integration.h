@@ -4,12 +4,30 @@
 #define INTEGRATION_H
 
 #include <vector>
+#include <cstddef>
 #include <functional> // Kluczowe dla std::function
+#include <optional>
+#include <iosfwd>
 #include <stdexcept>
 
 namespace numeric {
 namespace integration {
 
+    /**
+     * @brief Funkcja wektorowa: wypelnia fx[i] = f(x[i]) dla i < count.
+     * Pozwala zamortyzowac koszt wywolania i zwektoryzowac obliczenia po stronie uzytkownika.
+     */
+    using BatchFunction = std::function<void(const double* x, double* fx, std::size_t count)>;
+
+    /**
+     * @brief Wynik metod adaptacyjnych: wartosc calki, oszacowanie bledu i liczba wywolan f.
+     */
+    struct IntegrationResult {
+        double value;
+        double error_estimate;
+        int evaluations;
+    };
+
     /**
      * @brief Oblicza całkę oznaczoną metodą prostokątów.
      * @param f Funkcja do całkowania.
@@ -61,6 +79,176 @@ namespace integration {
      */
     double segmentedGaussLegendre(const std::function<double(double)>& f, double a, double b, int nodes, int segments);
 
+    /**
+     * @brief Wersje blokowe metod powyzej: wezly sa generowane porcjami po block_size punktow,
+     * a f jest wywolywana raz na porcje. Wyniki sa zgodne z wersjami skalarnymi.
+     * @throws std::invalid_argument jak wersje skalarne oraz gdy block_size <= 0.
+     */
+    double rectangleRuleBatch(const BatchFunction& f, double a, double b, int n, int block_size = 256);
+    double trapezoidalRuleBatch(const BatchFunction& f, double a, double b, int n, int block_size = 256);
+    double simpsonRuleBatch(const BatchFunction& f, double a, double b, int n, int block_size = 256);
+    double segmentedGaussLegendreBatch(const BatchFunction& f, double a, double b, int nodes, int segments,
+                                       int block_size = 256);
+
+    /**
+     * @brief Oblicza całkę metodą Romberga (ekstrapolacja Richardsona ciągu metod trapezów).
+     * Na każdym poziomie krok jest połowiony, a f jest wyznaczana tylko w nowych punktach środkowych,
+     * więc poziom k kosztuje 2^(k-1) wywołań zamiast 2^k + 1.
+     * @param f Funkcja do całkowania.
+     * @param a Dolna granica całkowania.
+     * @param b Górna granica całkowania.
+     * @param tolerance Wymagana różnica między kolejnymi elementami diagonali tablicy Romberga.
+     * @param max_levels Maksymalna liczba połowień kroku (od 1 do 30).
+     * @return std::optional<IntegrationResult> z wynikiem lub pusty, jeśli nie osiągnięto tolerancji.
+     * @throws std::invalid_argument jeśli f jest pusta, tolerance <= 0 lub max_levels poza zakresem.
+     */
+    std::optional<IntegrationResult> rombergIntegration(const std::function<double(double)>& f, double a, double b,
+                                                        double tolerance = 1e-10, int max_levels = 20);
+
+    /**
+     * @brief Oblicza całkę kwadraturą podwójnie wykładniczą tanh-sinh na [a, b].
+     * Węzły zagęszczają się wykładniczo przy końcach przedziału, więc metoda radzi sobie
+     * z osobliwościami na końcach (np. 1/sqrt(x)); f nie jest wywoływana w samych punktach a i b.
+     * Każdy poziom połowi krok i dokłada tylko nowe węzły; tablice węzłów są liczone raz i współdzielone.
+     * @param tolerance Wymagana różnica między wynikami kolejnych poziomów.
+     * @param max_levels Maksymalna liczba połowień kroku (od 1 do 12).
+     * @return std::optional<IntegrationResult> z wynikiem lub pusty, jeśli nie osiągnięto tolerancji.
+     * @throws std::invalid_argument jeśli f jest pusta, a >= b, tolerance <= 0 lub max_levels poza zakresem.
+     */
+    std::optional<IntegrationResult> tanhSinhIntegration(const std::function<double(double)>& f, double a, double b,
+                                                         double tolerance = 1e-10, int max_levels = 8);
+
+    /**
+     * @brief Oblicza całkę na przedziale [a, inf) kwadraturą exp-sinh (parametry jak w tanhSinhIntegration).
+     */
+    std::optional<IntegrationResult> expSinhIntegration(const std::function<double(double)>& f, double a,
+                                                        double tolerance = 1e-10, int max_levels = 8);
+
+    /**
+     * @brief Oblicza całkę na przedziale (-inf, inf) kwadraturą sinh-sinh (parametry jak w tanhSinhIntegration).
+     */
+    std::optional<IntegrationResult> sinhSinhIntegration(const std::function<double(double)>& f,
+                                                         double tolerance = 1e-10, int max_levels = 8);
+
+    /**
+     * @brief Oblicza całkę ∫_0^inf x^alpha e^{-x} f(x) dx kwadraturą Gaussa-Laguerre'a (uogólnioną dla alpha != 0).
+     * Węzły i wagi dowolnego rzędu są wyznaczane algorytmem Golub-Welscha i zapamiętywane.
+     * @param f Funkcja mnożona przez wagę x^alpha e^{-x}.
+     * @param nodes Liczba węzłów (od 1 do 1000).
+     * @param alpha Parametr wagi (alpha > -1).
+     * @throws std::invalid_argument jeśli f jest pusta, nodes poza zakresem lub alpha <= -1.
+     */
+    double gaussLaguerre(const std::function<double(double)>& f, int nodes, double alpha = 0.0);
+
+    /**
+     * @brief Oblicza całkę ∫_{-inf}^{inf} |x|^{2 mu} e^{-x^2} f(x) dx kwadraturą Gaussa-Hermite'a (uogólnioną dla mu != 0).
+     * @param f Funkcja mnożona przez wagę |x|^{2 mu} e^{-x^2}.
+     * @param nodes Liczba węzłów (od 1 do 1000).
+     * @param mu Parametr wagi (mu > -1/2).
+     * @throws std::invalid_argument jeśli f jest pusta, nodes poza zakresem lub mu <= -1/2.
+     */
+    double gaussHermite(const std::function<double(double)>& f, int nodes, double mu = 0.0);
+
+    // === Calkowanie funkcji wektorowych (wiele calek w jednym przebiegu) ===
+
+    /**
+     * @brief Funkcja o wartosciach wektorowych: zapisuje f_k(x) do values[k] dla k < liczby skladowych.
+     */
+    using VectorFunction = std::function<void(double x, double* values)>;
+
+    struct VectorIntegrationResult {
+        std::vector<double> values;
+        std::vector<double> error_estimates;
+        int evaluations;
+    };
+
+    /**
+     * @brief Oblicza calki wszystkich skladowych zlozona kwadratura Gaussa-Legendre'a w jednym przebiegu
+     * (wezly wspolne dla wszystkich skladowych, jedno wywolanie f na wezel).
+     * @param components Liczba skladowych zwracanych przez f.
+     * @throws std::invalid_argument jesli f jest pusta, components == 0, segments <= 0 lub nodes nie jest 2, 3, 4.
+     */
+    std::vector<double> segmentedGaussLegendreVector(const VectorFunction& f, std::size_t components,
+                                                     double a, double b, int nodes, int segments);
+
+    /**
+     * @brief Adaptacyjna metoda Simpsona z siatka wspolna dla wszystkich skladowych:
+     * przedzial jest dzielony, dopoki najwiekszy blad sposrod skladowych przekracza tolerancje.
+     * @param tolerance Bezwzgledna tolerancja bledu dla kazdej skladowej.
+     * @param max_depth Maksymalna glebokosc podzialu (od 1 do 50).
+     * @return std::optional<VectorIntegrationResult> lub pusty, jesli przekroczono max_depth.
+     * @throws std::invalid_argument przy nieprawidlowych argumentach.
+     */
+    std::optional<VectorIntegrationResult> adaptiveSimpsonVector(const VectorFunction& f, std::size_t components,
+                                                                 double a, double b, double tolerance = 1e-10,
+                                                                 int max_depth = 30);
+
+    // === Calkowanie danych stablicowanych (x, y) ===
+
+    enum class TabulatedRule { Trapezoidal, Simpson };
+
+    /**
+     * @brief Wywolywana po kazdej probce z biezacym x i calka od pierwszej probki do x.
+     */
+    using CumulativeCallback = std::function<void(double x, double integral)>;
+
+    /**
+     * @brief Strumieniowy integrator probek (x, y) o stalej pamieci (przechowuje tylko 3 ostatnie probki).
+     * Metoda Simpsona uzywa wzoru dla niejednorodnych krokow (dla stalego kroku sprowadza sie do klasycznego),
+     * a nieparzysty ostatni przedzial jest domykany poprawka z trzech ostatnich punktow.
+     * Trajektorie zapisane przez ode::TrajectoryWriter mozna calkowac bez kopiowania: ode::TrajectoryReader
+     * mapuje plik, a kolumny xColumn/stateColumn kolejnych porcji (precyzja Float64) przekazuje sie do addSamples.
+     */
+    class StreamingIntegrator {
+    public:
+        explicit StreamingIntegrator(TabulatedRule rule = TabulatedRule::Trapezoidal,
+                                     CumulativeCallback on_sample = nullptr);
+
+        /**
+         * @brief Dodaje probke.
+         * @throws std::invalid_argument jesli x nie jest wieksze od poprzedniego x.
+         */
+        void addSample(double x, double y);
+        void addSamples(const double* x, const double* y, std::size_t count);
+
+        /**
+         * @brief Calka od pierwszej do ostatniej dodanej probki (0 dla mniej niz 2 probek).
+         */
+        double result() const;
+        std::size_t sampleCount() const { return count_; }
+
+    private:
+        TabulatedRule rule_;
+        CumulativeCallback on_sample_;
+        std::size_t count_ = 0;
+        double xs_[3] = { 0.0, 0.0, 0.0 }; // xs_[2] to ostatnia probka
+        double ys_[3] = { 0.0, 0.0, 0.0 };
+        double completed_ = 0.0;           // Calka do ostatniego punktu o parzystym indeksie (Simpson) lub do ostatniego (trapezy)
+    };
+
+    /**
+     * @brief Calkuje dane tekstowe z linii "x,y" (lub "x y") wczytywane porcjami po chunk_size probek.
+     * Puste linie i linie zaczynajace sie od '#' sa pomijane.
+     * @throws std::runtime_error jesli linia nie zawiera dwoch liczb.
+     */
+    double integrateCsvStream(std::istream& in, TabulatedRule rule,
+                              const CumulativeCallback& on_sample = nullptr, std::size_t chunk_size = 4096);
+
+    /**
+     * @brief Calkuje dane binarne: przeplatane pary double (x, y) w natywnym porzadku bajtow.
+     * Dla plikow trajektorii modulu ode zamiast strumienia lepiej uzyc ode::TrajectoryReader i addSamples.
+     * @throws std::runtime_error jesli strumien konczy sie niepelnym rekordem.
+     */
+    double integrateBinaryStream(std::istream& in, TabulatedRule rule,
+                                 const CumulativeCallback& on_sample = nullptr, std::size_t chunk_size = 4096);
+
+    /**
+     * @brief Calkuje dane binarne zawierajace tylko wartosci y (double) probkowane ze stalym krokiem dx od x0.
+     * @throws std::invalid_argument jesli dx <= 0.
+     */
+    double integrateUniformBinaryStream(std::istream& in, double x0, double dx, TabulatedRule rule,
+                                        const CumulativeCallback& on_sample = nullptr, std::size_t chunk_size = 4096);
+
 } // namespace integration
 } // namespace numeric
 
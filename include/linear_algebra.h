@@ -1,6 +1,7 @@
 #pragma once // Zapewnia, że plik będzie dołączony tylko raz
 
 #include <vector>
+#include <cstddef>
 #include <stdexcept> // Do rzucania wyjątków
 #include <iostream> // Do drukowania na konsolę
 #include <iomanip> // Do formatowania wyjścia
@@ -22,6 +23,83 @@ namespace linear_algebra {
     std::vector<double> gaussElimination(std::vector<std::vector<double>> A, std::vector<double> b);
     std::vector<double> luDecomposition(std::vector<std::vector<double>> A, std::vector<double> b);
 
+    /**
+     * @brief Rozklad PA = LU z czesciowym pivotingiem, do wielokrotnego rozwiazywania ukladow z ta sama macierza.
+     * lu przechowuje U na i nad przekatna oraz L (bez jedynek na przekatnej) pod nia;
+     * wiersz i rozkladu odpowiada wierszowi permutation[i] macierzy A.
+     */
+    struct LuFactorization {
+        std::vector<std::vector<double>> lu;
+        std::vector<int> permutation;
+    };
+
+    /**
+     * @brief Wyznacza rozklad LU macierzy kwadratowej.
+     * @throw std::invalid_argument Jesli macierz nie jest kwadratowa lub jest pusta.
+     * @throw std::runtime_error Jesli macierz jest osobliwa.
+     */
+    LuFactorization luFactorize(std::vector<std::vector<double>> A);
+
+    /**
+     * @brief Rozwiazuje Ax = b dla gotowego rozkladu; x musi byc innym wektorem niz b
+     * i nie jest realokowany, jesli ma juz wlasciwy rozmiar.
+     * @throw std::invalid_argument Jesli rozmiar b nie zgadza sie z rozkladem.
+     */
+    void luSolve(const LuFactorization& factorization, const std::vector<double>& b, std::vector<double>& x);
+    std::vector<double> luSolve(const LuFactorization& factorization, const std::vector<double>& b);
+
+    /**
+     * @brief Macierz wstegowa n x n o lower podprzekatnych i upper nadprzekatnych.
+     * Element (i, j) dla i - lower <= j <= i + upper jest przechowywany w band[i * (lower + upper + 1) + j - i + lower];
+     * pamiec i koszt mnozenia sa O(n * (lower + upper)).
+     */
+    struct BandedMatrix {
+        std::size_t n = 0;
+        std::size_t lower = 0;
+        std::size_t upper = 0;
+        std::vector<double> band;
+
+        BandedMatrix() = default;
+        BandedMatrix(std::size_t n, std::size_t lower, std::size_t upper)
+            : n(n), lower(lower), upper(upper), band(n * (lower + upper + 1), 0.0) {}
+
+        bool inBand(std::size_t i, std::size_t j) const { return j + lower >= i && j <= i + upper; }
+        double& operator()(std::size_t i, std::size_t j) { return band[i * (lower + upper + 1) + j + lower - i]; }
+        double operator()(std::size_t i, std::size_t j) const { return band[i * (lower + upper + 1) + j + lower - i]; }
+    };
+
+    /**
+     * @brief Oblicza y = A x dla macierzy wstegowej.
+     * @throw std::invalid_argument Jesli rozmiar x nie zgadza sie z macierza.
+     */
+    void bandedMultiply(const BandedMatrix& A, const std::vector<double>& x, std::vector<double>& y);
+
+    /**
+     * @brief Rozklad LU macierzy wstegowej z czesciowym pivotingiem (jak LAPACK dgbtrf): zamiany wierszy
+     * poszerzaja U do lower + upper nadprzekatnych, a mnozniki L zostaja w miejscu eliminacji.
+     */
+    struct BandedLuFactorization {
+        std::size_t n = 0;
+        std::size_t lower = 0;
+        std::size_t upper = 0;             // Szerokosc U po pivotingu: lower + upper oryginalu
+        std::vector<double> lu;            // Wiersz i: kolumny [i - lower, i + upper], jak w BandedMatrix
+        std::vector<std::size_t> pivots;   // W kroku k zamieniono wiersze k i pivots[k]
+    };
+
+    /**
+     * @brief Wyznacza rozklad LU macierzy wstegowej kosztem O(n * lower * (lower + upper)).
+     * @throw std::invalid_argument Jesli macierz jest pusta lub rozmiar pasma nie zgadza sie z wymiarami.
+     * @throw std::runtime_error Jesli macierz jest osobliwa.
+     */
+    BandedLuFactorization bandedLuFactorize(const BandedMatrix& A);
+
+    /**
+     * @brief Rozwiazuje Ax = b kosztem O(n * (lower + upper)); x musi byc innym wektorem niz b.
+     * @throw std::invalid_argument Jesli rozmiar b nie zgadza sie z rozkladem.
+     */
+    void bandedLuSolve(const BandedLuFactorization& factorization, const std::vector<double>& b, std::vector<double>& x);
+    std::vector<double> bandedLuSolve(const BandedLuFactorization& factorization, const std::vector<double>& b);
+
     // Tutaj będziesz dodawać deklaracje kolejnych funkcji, np.:
     // double dot_product(const std::vector<double>& a, const std::vector<double>& b);
 
@@ -0,0 +1,133 @@
+// include/method_of_lines.h
+
+#ifndef METHOD_OF_LINES_H
+#define METHOD_OF_LINES_H
+
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include "linear_algebra.h"
+#include "differential_equations.h"
+
+namespace numeric {
+namespace pde {
+
+    enum class BoundaryType {
+        Dirichlet, // u = value
+        Neumann    // du/dx (lub du/dy) = value, realizowane punktem fikcyjnym
+    };
+
+    struct Boundary {
+        BoundaryType type = BoundaryType::Dirichlet;
+        double value = 0.0;
+    };
+
+    enum class AdvectionScheme {
+        Upwind,  // 1. rzad, monotoniczny
+        Central  // 2. rzad, moze oscylowac przy duzej liczbie Pecleta
+    };
+
+    /**
+     * @brief Rownanie u_t = D u_xx - a u_x + s(x, t) na siatce points wezlow rownomiernych w [x_min, x_max].
+     */
+    struct Problem1D {
+        double x_min = 0.0;
+        double x_max = 1.0;
+        std::size_t points = 101;    // Razem z wezlami brzegowymi
+        double diffusion = 0.0;      // D >= 0
+        double velocity = 0.0;       // a
+        AdvectionScheme advection = AdvectionScheme::Upwind;
+        Boundary left, right;
+        std::function<double(double x, double t)> source; // Opcjonalne zrodlo s
+    };
+
+    /**
+     * @brief Rownanie u_t = D (u_xx + u_yy) - a_x u_x - a_y u_y + s(x, y, t) na prostokacie nx x ny wezlow.
+     * W narozach warunek Dirichleta ma pierwszenstwo, a brzegi left/right przed bottom/top.
+     */
+    struct Problem2D {
+        double x_min = 0.0, x_max = 1.0;
+        double y_min = 0.0, y_max = 1.0;
+        std::size_t nx = 41, ny = 41;
+        double diffusion = 0.0;
+        double velocity_x = 0.0, velocity_y = 0.0;
+        AdvectionScheme advection = AdvectionScheme::Upwind;
+        Boundary left, right, bottom, top;
+        std::function<double(double x, double y, double t)> source;
+    };
+
+    /**
+     * @brief Poldyskretyzacja u' = A u + b + s(t) po wyeliminowaniu wezlow Dirichleta.
+     * Niewiadome to wartosci w pozostalych wezlach w porzadku wierszowym (x zmienia sie najszybciej),
+     * wiec A jest wstegowa: szerokosc 1 w 1-D i nx w 2-D.
+     */
+    class SemiDiscretization {
+    public:
+        std::size_t size() const { return matrix_.n; }
+        const linear_algebra::BandedMatrix& matrix() const { return matrix_; }
+        const std::vector<double>& constantTerm() const { return constant_; }
+
+        // Wspolrzedne wezla odpowiadajacego niewiadomej i (y = 0 w 1-D)
+        double x(std::size_t i) const { return x_[i]; }
+        double y(std::size_t i) const { return y_[i]; }
+
+        /**
+         * @brief Wartosci funkcji u0 w wezlach niewiadomych.
+         */
+        std::vector<double> sample(const std::function<double(double x, double y)>& u0) const;
+
+        /**
+         * @brief Prawa strona u' = A u + b + s(t) (O(n * szerokosc pasma)).
+         */
+        void rhs(double t, const std::vector<double>& u, std::vector<double>& dudt) const;
+
+        /**
+         * @brief Prawa strona w postaci przyjmowanej przez solvery modulu ode (kopia poldyskretyzacji).
+         */
+        ode::OdeSystemFunction system() const;
+
+        /**
+         * @brief Krok, przy ktorym jawna metoda Eulera jest stabilna (z twierdzenia Gerszgorina);
+         * dla RK4 mozna uzyc okolo 1.4 razy wiekszego.
+         * @throws std::runtime_error jesli w ktoryms wierszu suma modulow poza przekatna przekracza modul elementu
+         * przekatnej (adwekcja centralna przy liczbie Pecleta siatki > 2) - wartosci wlasne moga wtedy lezec
+         * na osi urojonej i zaden krok Eulera nie jest gwarantowanie stabilny.
+         */
+        double explicitStepLimit() const;
+
+    private:
+        friend SemiDiscretization discretize(const Problem1D& problem);
+        friend SemiDiscretization discretize(const Problem2D& problem);
+
+        linear_algebra::BandedMatrix matrix_;
+        std::vector<double> constant_;
+        std::vector<double> x_, y_;
+        std::function<double(double x, double y, double t)> source_;
+    };
+
+    /**
+     * @brief Tworzy poldyskretyzacje roznicami centralnymi (dyfuzja) i wybranym schematem adwekcji.
+     * @throws std::invalid_argument przy mniej niz 3 wezlach w kierunku, pustym przedziale lub D < 0.
+     */
+    SemiDiscretization discretize(const Problem1D& problem);
+    SemiDiscretization discretize(const Problem2D& problem);
+
+    /**
+     * @brief Calkuje poldyskretyzacje niejawnym schematem theta o stalym kroku dt:
+     * (I - theta dt A) u_{n+1} = (I + (1 - theta) dt A) u_n + dt (b + theta s_{n+1} + (1 - theta) s_n).
+     * theta = 1 to niejawna metoda Eulera, theta = 0.5 to Cranka-Nicolson. Macierz jest rozkladana raz
+     * (wstegowe LU), a kazdy krok kosztuje O(n * szerokosc pasma).
+     * @return Stany w chwilach t0 + i*dt <= t_end.
+     * @throws std::invalid_argument przy zlym rozmiarze u0, dt <= 0, t_end < t0 lub theta poza [0, 1].
+     * @throws std::runtime_error jesli macierz ukladu jest osobliwa.
+     */
+    ode::SystemSolution thetaMethod(const SemiDiscretization& system, const std::vector<double>& u0, double t0,
+                                    double dt, double t_end, double theta = 0.5);
+    void thetaMethod(const SemiDiscretization& system, const std::vector<double>& u0, double t0, double dt,
+                     double t_end, double theta, const ode::SystemObserver& observer);
+
+} // namespace pde
+} // namespace numeric
+
+#endif // METHOD_OF_LINES_H
@@ -5,6 +5,9 @@
 
 #include <functional>
 #include <optional>
+#include <vector>
+#include <complex>
+#include <cstddef>
 #include <stdexcept>
 
 namespace numeric {
@@ -43,6 +46,220 @@ namespace nonlinear {
     std::optional<double> newtonMethod(const NonLinearFunction& f, double x0,
                                        double epsilon = 1e-7, int max_iter = 100, double h = 1e-5);
 
+    /**
+     * @brief Wynik metod hybrydowych: pierwiastek i koszt jego znalezienia.
+     */
+    struct RootResult {
+        double root = 0.0;
+        int evaluations = 0; // Liczba wywolan f (razem z koncami przedzialu)
+        int iterations = 0;
+    };
+
+    /**
+     * @brief Znajduje miejsce zerowe metoda Brenta-Dekkera: interpolacja odwrotna kwadratowa lub sieczne
+     * z zabezpieczeniem bisekcja. Zbiega zawsze (nie wolniej niz okolo 2x bisekcja) i zwykle nadliniowo.
+     * @param f Funkcja o roznych znakach na koncach przedzialu [a, b].
+     * @param epsilon Dokladnosc polozenia pierwiastka (polowa szerokosci koncowego przedzialu).
+     * @param max_iter Maksymalna liczba iteracji.
+     * @return RootResult lub pusty, gdy f(a) i f(b) maja ten sam znak albo przekroczono max_iter.
+     * @throws std::invalid_argument jesli f jest puste, a >= b, epsilon <= 0 lub max_iter <= 0.
+     */
+    std::optional<RootResult> brentMethod(const NonLinearFunction& f, double a, double b,
+                                          double epsilon = 1e-7, int max_iter = 100);
+
+    /**
+     * @brief Znajduje miejsce zerowe metoda Chandrupatli: interpolacja odwrotna kwadratowa uzywana tylko wtedy,
+     * gdy trzy ostatnie punkty wskazuja na lokalnie monotoniczna funkcje, w przeciwnym razie bisekcja.
+     * Parametry i wynik jak w brentMethod.
+     */
+    std::optional<RootResult> chandrupatlaMethod(const NonLinearFunction& f, double a, double b,
+                                                 double epsilon = 1e-7, int max_iter = 100);
+
+    /**
+     * @brief Znajduje miejsce zerowe metoda ITP (Interpolate-Truncate-Project): regula falsi przesunieta
+     * w strone srodka i rzutowana na otoczenie srodka. Gwarantuje co najwyzej o jedna iteracje wiecej niz
+     * bisekcja, a dla gladkich funkcji zbiega nadliniowo. Parametry i wynik jak w brentMethod.
+     */
+    std::optional<RootResult> itpMethod(const NonLinearFunction& f, double a, double b,
+                                        double epsilon = 1e-7, int max_iter = 100);
+
+    /**
+     * @brief Znajduje miejsce zerowe metoda wielopodzialu: w kazdej rundzie f liczona jest rownolegle w sections - 1
+     * punktach wewnetrznych, a przedzial zaweza sie sections razy (bisekcja to sections = 2). Dla kosztownych f
+     * z threads = sections - 1 czas do pierwiastka maleje okolo log2(sections) razy wzgledem bisekcji.
+     * Watki tworzone sa w kazdej rundzie, wiec oplaca sie to dopiero, gdy jedno wywolanie f trwa dluzej niz
+     * utworzenie watku (dziesiatki mikrosekund). f musi byc bezpieczna do wywolan z wielu watkow.
+     * Kryteria stopu jak w bisectionMethod: szerokosc przedzialu < epsilon lub |f| < epsilon.
+     * @return RootResult (iterations to liczba rund) lub pusty, gdy f(a) i f(b) maja ten sam znak
+     * albo przekroczono max_iter.
+     * @throws std::invalid_argument jesli f jest puste, a >= b, sections < 2, epsilon <= 0, max_iter <= 0 lub threads <= 0.
+     */
+    std::optional<RootResult> multisectionMethod(const NonLinearFunction& f, double a, double b, int sections = 4,
+                                                 double epsilon = 1e-7, int max_iter = 100, int threads = 1);
+
+    // === Wsadowe wyznaczanie pierwiastkow wielu niezaleznych rownan f(x; p_i) = 0 ===
+    // Problemy przetwarzane sa blokami po 256 w ukladzie SoA: wszystkie aktywne problemy bloku wykonuja
+    // krok rownoczesnie, a f liczona jest jednym wywolaniem dla calego bloku. Problemy zbiezne sa maskowane
+    // (ich x przestaje sie zmieniac), a blok konczy sie, gdy zbiegly wszystkie. Bloki dzielone sa miedzy watki.
+    // W metodach Newtona i bisekcji krok liczony jest dla wszystkich problemow bloku i wybierany maska, bez
+    // rozgalezien, wiec przy optymalizacji (np. -O3) kompilator wektoryzuje petle aktualizacji.
+
+    /**
+     * @brief Funkcja wsadowa: fx[m] = f(x[m]; p_{first + m}) dla m < count; first to numer pierwszego problemu,
+     * co pozwala odczytac parametry z tablic uzytkownika.
+     */
+    using BatchRootFunction = std::function<void(const double* x, double* fx, std::size_t first, std::size_t count)>;
+
+    /**
+     * @brief Jak BatchRootFunction, ale wypelnia rowniez dfx[m] = f'(x[m]; p_{first + m}).
+     */
+    using BatchDerivativeFunction =
+        std::function<void(const double* x, double* fx, double* dfx, std::size_t first, std::size_t count)>;
+
+    /**
+     * @brief Wyniki dla wszystkich problemow; pierwiastek ma sens tylko tam, gdzie converged[i] != 0.
+     */
+    struct BatchRootResult {
+        std::vector<double> roots;
+        std::vector<unsigned char> converged;
+        std::vector<int> iterations;
+        std::size_t evaluations = 0; // Laczna liczba policzonych wartosci f (punkt razy problem)
+
+        std::size_t size() const { return roots.size(); }
+        std::size_t failures() const;
+    };
+
+    /**
+     * @brief Metoda Newtona dla wielu problemow; kryteria zbieznosci i niepowodzenia jak w newtonMethod.
+     * @param x0 Punkty startowe (jeden na problem).
+     * @param threads Liczba watkow.
+     * @throws std::invalid_argument jesli f jest puste, x0 jest pusty, epsilon <= 0, max_iter <= 0 lub threads <= 0.
+     */
+    BatchRootResult newtonMethodBatch(const BatchDerivativeFunction& f, const std::vector<double>& x0,
+                                      double epsilon = 1e-7, int max_iter = 100, int threads = 1);
+
+    /**
+     * @brief Metoda bisekcji dla wielu problemow (jak bisectionMethod); problem bez zmiany znaku na koncach
+     * przedzialu [a[i], b[i]] konczy sie niepowodzeniem.
+     * @throws std::invalid_argument jak newtonMethodBatch oraz gdy a i b maja rozne rozmiary lub a[i] >= b[i].
+     */
+    BatchRootResult bisectionMethodBatch(const BatchRootFunction& f, const std::vector<double>& a,
+                                         const std::vector<double>& b, double epsilon = 1e-7, int max_iter = 100,
+                                         int threads = 1);
+
+    /**
+     * @brief Metoda Brenta dla wielu problemow (jak brentMethod, te same wyniki co wywolania skalarne).
+     * @throws std::invalid_argument jak bisectionMethodBatch.
+     */
+    BatchRootResult brentMethodBatch(const BatchRootFunction& f, const std::vector<double>& a,
+                                     const std::vector<double>& b, double epsilon = 1e-7, int max_iter = 100,
+                                     int threads = 1);
+
+
+    // === Wszystkie pierwiastki w przedziale ===
+
+    struct RootSearchOptions {
+        std::size_t subdivisions = 1000;  // Liczba podprzedzialow siatki wstepnej
+        double epsilon = 1e-10;           // Dokladnosc pierwiastka (brentMethod)
+        int max_iter = 100;
+        int threads = 1;
+        bool detect_tangential = true;    // Szukanie pierwiastkow bez zmiany znaku w lokalnych minimach |f|
+        double tangent_tolerance = 1e-10; // |f| w minimum, ponizej ktorego minimum uznajemy za pierwiastek
+    };
+
+    /**
+     * @brief Znajduje wszystkie pierwiastki f w [a, b]: wartosci f na siatce subdivisions + 1 punktow
+     * (liczone rownolegle) wyznaczaja przedzialy ze zmiana znaku, a trojki punktow, w ktorych |f| ma lokalne
+     * minimum bez zmiany znaku, sa badane zlotym podzialem (pierwiastki podwojne lub para bliskich pierwiastkow).
+     * Wszystkie przedzialy sa nastepnie zawezane rownolegle metoda Brenta.
+     * Pierwiastki blizsze niz siatka moga zostac pominiete, jesli nie daja widocznego minimum |f|.
+     * @return Pierwiastki posortowane rosnaco, bez powtorzen (blizsze niz 4 * epsilon sa laczone).
+     * @throws std::invalid_argument jesli f jest puste, a >= b, subdivisions == 0, epsilon <= 0,
+     * max_iter <= 0, threads <= 0 lub tangent_tolerance < 0.
+     */
+    std::vector<double> findAllRoots(const NonLinearFunction& f, double a, double b,
+                                     const RootSearchOptions& options = RootSearchOptions());
+
+    // === Pierwiastki wielomianow ===
+
+    struct PolynomialRootOptions {
+        double epsilon = 1e-15;  // Wzgledny blad wsteczny |p(z)| / sum |c_k| |z|^k (nie mniej niz ~4 n eps maszynowego)
+        int max_iter = 200;      // Iteracje Aberth-Ehrlicha przed przejsciem do macierzy stowarzyszonej
+        int threads = 1;
+    };
+
+    struct PolynomialRoots {
+        std::vector<std::complex<double>> roots; // Posortowane wg czesci rzeczywistej, potem urojonej
+        int iterations = 0;
+        bool converged = false;
+        bool used_companion = false;             // Wynik pochodzi z wartosci wlasnych macierzy stowarzyszonej
+    };
+
+    /**
+     * @brief Wyznacza wszystkie (rzeczywiste i zespolone) pierwiastki wielomianu
+     * p(x) = coefficients[0] + coefficients[1] x + ... + coefficients[n] x^n metoda Aberth-Ehrlicha:
+     * wszystkie przyblizenia poprawiane sa jednoczesnie (O(n^2) na iteracje, rownolegle po pierwiastkach),
+     * a punkty startowe leza na okregach wyznaczonych z wielokata Newtona. Pierwiastek spelniajacy kryterium
+     * bledu wstecznego jest zamrazany. Dla |z| > 1 wielomian liczony jest w postaci odwroconej, co pozwala na stopnie
+     * rzedu 1000 bez przepelnienia. Jesli iteracja nie zbiegnie w max_iter krokach, pierwiastki wyznaczane sa jako
+     * wartosci wlasne zrownowazonej macierzy stowarzyszonej (QR z podwojnym przesunieciem na postaci Hessenberga, O(n^3)).
+     * Zerowe wspolczynniki najwyzszych poteg sa pomijane, a zerowe najnizszych daja dokladne pierwiastki 0.
+     * Pierwiastki, dla ktorych kryterium spelnia juz czesc rzeczywista, zwracane sa z czescia urojona 0.
+     * @throws std::invalid_argument jesli wszystkie wspolczynniki sa zerowe, epsilon <= 0, max_iter <= 0 lub threads <= 0.
+     */
+    PolynomialRoots polynomialRoots(const std::vector<double>& coefficients,
+                                    const PolynomialRootOptions& options = PolynomialRootOptions());
+
+    // === Uklady rownan nieliniowych F(x) = 0, F: R^n -> R^n ===
+
+    /**
+     * @brief Funkcja wektorowa: zapisuje F(x) do fx (rozmiar n, przygotowany przez solver).
+     */
+    using SystemFunction = std::function<void(const std::vector<double>& x, std::vector<double>& fx)>;
+
+    /**
+     * @brief Jakobian: zapisuje J[i][j] = d F_i / d x_j do macierzy n x n przygotowanej przez solver.
+     */
+    using SystemJacobian = std::function<void(const std::vector<double>& x, std::vector<std::vector<double>>& J)>;
+
+    enum class SystemMethod {
+        Newton, // Jakobian (i rozklad LU) w kazdej iteracji
+        Broyden // Jakobian tylko na starcie i przy restartach, dalej poprawki rzedu 1 odwrotnosci jakobianu
+    };
+
+    /**
+     * @brief Ustawienia solvera ukladow. Pusty jacobian oznacza roznice skonczone w przod
+     * (n dodatkowych wywolan F, wartosc F(x) z biezacej iteracji jest uzywana ponownie).
+     */
+    struct SystemSolverOptions {
+        SystemMethod method = SystemMethod::Newton;
+        SystemJacobian jacobian;
+        double tolerance = 1e-10;       // Zbieznosc, gdy max |F_i(x)| < tolerance
+        double step_tolerance = 1e-12;  // lub gdy max |dx_i| < step_tolerance * (1 + max |x_i|)
+        int max_iter = 100;
+        bool line_search = true;        // Przyciecie kroku (warunek Armijo dla 0.5 ||F||^2)
+    };
+
+    struct SystemRootResult {
+        std::vector<double> root;
+        double residual = 0.0;          // max |F_i(root)|
+        int iterations = 0;
+        int function_evaluations = 0;   // Razem z wywolaniami na potrzeby jakobianu roznicowego
+        int jacobian_evaluations = 0;
+        int factorizations = 0;
+    };
+
+    /**
+     * @brief Rozwiazuje uklad F(x) = 0 metoda Newtona lub Broydena (options.method) startujac z x0.
+     * Krok Newtona wyznaczany jest rozkladem LU z modulu linear_algebra. W trybie Broydena odwrotnosc
+     * jakobianu jest aktualizowana wzorem Shermana-Morrisona (O(n^2) i jedno wywolanie F na iteracje);
+     * gdy krok Broydena nie zmniejsza ||F||, jakobian jest liczony od nowa.
+     * @return SystemRootResult lub pusty, gdy jakobian jest osobliwy, przeszukiwanie liniowe nie zmniejsza
+     * ||F|| mimo swiezego jakobianu albo przekroczono max_iter.
+     * @throws std::invalid_argument jesli F jest puste, x0 jest pusty, tolerancje sa niedodatnie lub max_iter <= 0.
+     */
+    std::optional<SystemRootResult> solveSystem(const SystemFunction& F, const std::vector<double>& x0,
+                                                const SystemSolverOptions& options = SystemSolverOptions());
 
 } // namespace nonlinear
 } // namespace numeric
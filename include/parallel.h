@@ -0,0 +1,72 @@
+// include/parallel.h
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace numeric {
+namespace parallel {
+
+    /**
+     * @brief Wykonuje task(item, worker) dla item = 0..count-1 na co najwyzej threads watkach.
+     * Watki pobieraja kolejne elementy ze wspolnego licznika, co wyrownuje obciazenie przy roznym koszcie zadan;
+     * worker (0..threads-1) pozwala uzywac buforow przydzielonych raz na watek.
+     * Przy threads == 1 zadania wykonywane sa w watku wywolujacym. Pierwszy wyjatek rzucony przez zadanie
+     * przerywa pobieranie kolejnych elementow i jest przekazywany wywolujacemu.
+     * @throws std::invalid_argument jesli threads <= 0.
+     */
+    inline void parallelFor(std::size_t count, int threads,
+                            const std::function<void(std::size_t item, std::size_t worker)>& task) {
+        if (threads <= 0) {
+            throw std::invalid_argument("Liczba watkow musi byc dodatnia.");
+        }
+        const std::size_t pool_size = std::min<std::size_t>(static_cast<std::size_t>(threads), count);
+        if (pool_size <= 1) {
+            for (std::size_t item = 0; item < count; ++item) {
+                task(item, 0);
+            }
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::exception_ptr failure;
+        std::mutex failure_mutex;
+        auto worker = [&](std::size_t id) {
+            for (std::size_t item = next++; item < count; item = next++) {
+                try {
+                    task(item, id);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(failure_mutex);
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                    next = count; // Pozostale watki koncza po biezacym zadaniu
+                }
+            }
+        };
+        std::vector<std::thread> pool;
+        pool.reserve(pool_size);
+        for (std::size_t t = 0; t < pool_size; ++t) {
+            pool.emplace_back(worker, t);
+        }
+        for (auto& th : pool) {
+            th.join();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+} // namespace parallel
+} // namespace numeric
+
+#endif // PARALLEL_H
@@ -0,0 +1,241 @@
+// include/runge_kutta.h
+
+#ifndef RUNGE_KUTTA_H
+#define RUNGE_KUTTA_H
+
+#include <vector>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+namespace numeric {
+namespace ode {
+
+    // === Tablice Butchera jawnych metod Rungego-Kutty ===
+    // Metoda to typ ze statycznymi stalymi: stages, a[s][j] (j < s), b[s], c[s]. Nowa metoda to tylko nowa tablica;
+    // silnik ponizej jest szablonem, wiec petle po etapach maja stale granice, a prawa strona moze byc rozwinieta w miejscu.
+
+    struct EulerTableau {
+        static constexpr std::size_t stages = 1;
+        static constexpr double a[1][1] = { { 0.0 } };
+        static constexpr double b[1] = { 1.0 };
+        static constexpr double c[1] = { 0.0 };
+    };
+
+    struct HeunTableau {
+        static constexpr std::size_t stages = 2;
+        static constexpr double a[2][2] = { { 0.0, 0.0 }, { 1.0, 0.0 } };
+        static constexpr double b[2] = { 0.5, 0.5 };
+        static constexpr double c[2] = { 0.0, 1.0 };
+    };
+
+    struct MidpointTableau {
+        static constexpr std::size_t stages = 2;
+        static constexpr double a[2][2] = { { 0.0, 0.0 }, { 0.5, 0.0 } };
+        static constexpr double b[2] = { 0.0, 1.0 };
+        static constexpr double c[2] = { 0.0, 0.5 };
+    };
+
+    // Klasyczna metoda Kutty 3. rzedu
+    struct Kutta3Tableau {
+        static constexpr std::size_t stages = 3;
+        static constexpr double a[3][3] = { { 0.0, 0.0, 0.0 }, { 0.5, 0.0, 0.0 }, { -1.0, 2.0, 0.0 } };
+        static constexpr double b[3] = { 1.0 / 6.0, 2.0 / 3.0, 1.0 / 6.0 };
+        static constexpr double c[3] = { 0.0, 0.5, 1.0 };
+    };
+
+    // SSPRK3 Shu-Oshera: 3. rzad, zachowuje monotonicznosc kroku Eulera przy h <= h_Euler (semidyskretyzacje PDE)
+    struct Ssprk3Tableau {
+        static constexpr std::size_t stages = 3;
+        static constexpr double a[3][3] = { { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.25, 0.25, 0.0 } };
+        static constexpr double b[3] = { 1.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0 };
+        static constexpr double c[3] = { 0.0, 1.0, 0.5 };
+    };
+
+    struct Rk4Tableau {
+        static constexpr std::size_t stages = 4;
+        static constexpr double a[4][4] = {
+            { 0.0, 0.0, 0.0, 0.0 }, { 0.5, 0.0, 0.0, 0.0 }, { 0.0, 0.5, 0.0, 0.0 }, { 0.0, 0.0, 1.0, 0.0 } };
+        static constexpr double b[4] = { 1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0 };
+        static constexpr double c[4] = { 0.0, 0.5, 0.5, 1.0 };
+    };
+
+    // Regula 3/8 Kutty: 4. rzad, mniejsza stala bledu niz klasyczne RK4
+    struct Rk38Tableau {
+        static constexpr std::size_t stages = 4;
+        static constexpr double a[4][4] = {
+            { 0.0, 0.0, 0.0, 0.0 }, { 1.0 / 3.0, 0.0, 0.0, 0.0 }, { -1.0 / 3.0, 1.0, 0.0, 0.0 }, { 1.0, -1.0, 1.0, 0.0 } };
+        static constexpr double b[4] = { 0.125, 0.375, 0.375, 0.125 };
+        static constexpr double c[4] = { 0.0, 1.0 / 3.0, 2.0 / 3.0, 1.0 };
+    };
+
+    // Metoda Butchera 6. rzedu (7 etapow)
+    struct Butcher6Tableau {
+        static constexpr std::size_t stages = 7;
+        static constexpr double a[7][7] = {
+            { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+            { 1.0 / 3.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+            { 0.0, 2.0 / 3.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+            { 1.0 / 12.0, 1.0 / 3.0, -1.0 / 12.0, 0.0, 0.0, 0.0, 0.0 },
+            { -1.0 / 16.0, 9.0 / 8.0, -3.0 / 16.0, -3.0 / 8.0, 0.0, 0.0, 0.0 },
+            { 0.0, 9.0 / 8.0, -3.0 / 8.0, -3.0 / 4.0, 1.0 / 2.0, 0.0, 0.0 },
+            { 9.0 / 44.0, -9.0 / 11.0, 63.0 / 44.0, 18.0 / 11.0, 0.0, -16.0 / 11.0, 0.0 } };
+        static constexpr double b[7] = { 11.0 / 120.0, 0.0, 27.0 / 40.0, 27.0 / 40.0, -4.0 / 15.0, -4.0 / 15.0, 11.0 / 120.0 };
+        static constexpr double c[7] = { 0.0, 1.0 / 3.0, 2.0 / 3.0, 1.0 / 3.0, 1.0 / 2.0, 1.0 / 2.0, 1.0 };
+    };
+
+    namespace detail {
+        // Warunki zgodnosci sprawdzane w czasie kompilacji: sum b = 1 oraz c[s] = sum_j a[s][j]
+        template <typename Tableau>
+        constexpr bool isConsistentTableau() {
+            double b_sum = 0.0;
+            for (std::size_t s = 0; s < Tableau::stages; ++s) {
+                b_sum += Tableau::b[s];
+                double row = 0.0;
+                for (std::size_t j = 0; j < s; ++j) {
+                    row += Tableau::a[s][j];
+                }
+                double diff = row - Tableau::c[s];
+                if (diff > 1e-14 || diff < -1e-14) {
+                    return false;
+                }
+            }
+            return b_sum > 1.0 - 1e-14 && b_sum < 1.0 + 1e-14;
+        }
+
+        inline void validateStep(double h, double x0, double x_end) {
+            if (h <= 0) {
+                throw std::invalid_argument("Krok calkowania (h) musi byc dodatni.");
+            }
+            if (x_end < x0) {
+                throw std::invalid_argument("Punkt koncowy (x_end) nie moze byc mniejszy od punktu poczatkowego (x0).");
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Jeden krok jawnej metody Rungego-Kutty dla rownania skalarnego y' = f(x, y).
+     * @param f Dowolny obiekt wywolywalny double(double, double) - lambda jest rozwijana w miejscu.
+     * @return Przyblizenie y(x + h).
+     */
+    template <typename Tableau, typename F>
+    double rungeKuttaStep(F& f, double x, double y, double h) {
+        static_assert(detail::isConsistentTableau<Tableau>(), "Niespojna tablica Butchera.");
+        double k[Tableau::stages];
+        for (std::size_t s = 0; s < Tableau::stages; ++s) {
+            double y_stage = y;
+            for (std::size_t j = 0; j < s; ++j) {
+                // Zerowe wspolczynniki znikaja po rozwinieciu petli
+                if (Tableau::a[s][j] != 0.0) {
+                    y_stage += h * Tableau::a[s][j] * k[j];
+                }
+            }
+            k[s] = f(x + Tableau::c[s] * h, y_stage);
+        }
+        double increment = 0.0;
+        for (std::size_t s = 0; s < Tableau::stages; ++s) {
+            if (Tableau::b[s] != 0.0) {
+                increment += Tableau::b[s] * k[s];
+            }
+        }
+        return y + h * increment;
+    }
+
+    /**
+     * @brief Bufory etapow dla ukladow rownan - alokowane raz na cale rozwiazanie.
+     */
+    template <typename Tableau>
+    struct RungeKuttaWorkspace {
+        explicit RungeKuttaWorkspace(std::size_t n) : tmp(n) {
+            for (auto& stage : k) {
+                stage.resize(n);
+            }
+        }
+        std::array<std::vector<double>, Tableau::stages> k;
+        std::vector<double> tmp;
+    };
+
+    /**
+     * @brief Jeden krok jawnej metody Rungego-Kutty dla ukladu; y jest nadpisywany stanem w x + h.
+     * @param f Obiekt wywolywalny void(double x, const std::vector<double>& y, std::vector<double>& dydx).
+     */
+    template <typename Tableau, typename F>
+    void rungeKuttaStep(F& f, double x, std::vector<double>& y, double h, RungeKuttaWorkspace<Tableau>& w) {
+        static_assert(detail::isConsistentTableau<Tableau>(), "Niespojna tablica Butchera.");
+        const std::size_t n = y.size();
+        f(x, y, w.k[0]);
+        for (std::size_t s = 1; s < Tableau::stages; ++s) {
+            w.tmp = y;
+            for (std::size_t j = 0; j < s; ++j) {
+                if (Tableau::a[s][j] != 0.0) {
+                    const double coeff = h * Tableau::a[s][j];
+                    const std::vector<double>& kj = w.k[j];
+                    for (std::size_t i = 0; i < n; ++i) {
+                        w.tmp[i] += coeff * kj[i];
+                    }
+                }
+            }
+            f(x + Tableau::c[s] * h, w.tmp, w.k[s]);
+        }
+        for (std::size_t s = 0; s < Tableau::stages; ++s) {
+            if (Tableau::b[s] != 0.0) {
+                const double coeff = h * Tableau::b[s];
+                const std::vector<double>& ks = w.k[s];
+                for (std::size_t i = 0; i < n; ++i) {
+                    y[i] += coeff * ks[i];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Rozwiazuje rownanie skalarne jawna metoda Rungego-Kutty o stalym kroku,
+     * przekazujac punkty (x, y) do obserwatora observer(x, y) - jak rungeKutta4 z obserwatorem.
+     * @throws std::invalid_argument jesli h <= 0 lub x_end < x0.
+     */
+    template <typename Tableau, typename F, typename Obs>
+    void explicitRungeKutta(F&& f, double x0, double y0, double h, double x_end, Obs&& observer) {
+        detail::validateStep(h, x0, x_end);
+        double x = x0;
+        double y = y0;
+        while (true) {
+            observer(x, y);
+            // Kolejny punkt tylko wtedy, gdy x + h <= x_end
+            double x_next = x + h;
+            if (x_next > x_end) {
+                break;
+            }
+            y = rungeKuttaStep<Tableau>(f, x, y, h);
+            x = x_next;
+        }
+    }
+
+    /**
+     * @brief Rozwiazuje uklad jawna metoda Rungego-Kutty o stalym kroku w punktach x0 + i*h <= x_end,
+     * przekazujac stany do obserwatora observer(x, y) - jak rungeKutta4System z obserwatorem.
+     * @throws std::invalid_argument jesli h <= 0, x_end < x0 lub y0 jest pusty.
+     */
+    template <typename Tableau, typename F, typename Obs>
+    void explicitRungeKuttaSystem(F&& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                                  Obs&& observer) {
+        detail::validateStep(h, x0, x_end);
+        if (y0.empty()) {
+            throw std::invalid_argument("Wektor stanu poczatkowego (y0) nie moze byc pusty.");
+        }
+        const std::size_t steps = static_cast<std::size_t>(std::floor((x_end - x0) / h + 1e-9));
+        RungeKuttaWorkspace<Tableau> w(y0.size());
+        std::vector<double> y = y0;
+        for (std::size_t i = 0; i <= steps; ++i) {
+            const double x = x0 + static_cast<double>(i) * h;
+            observer(x, static_cast<const std::vector<double>&>(y));
+            if (i < steps) {
+                rungeKuttaStep<Tableau>(f, x, y, h, w);
+            }
+        }
+    }
+
+} // namespace ode
+} // namespace numeric
+
+#endif // RUNGE_KUTTA_H
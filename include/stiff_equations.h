@@ -0,0 +1,68 @@
+// include/stiff_equations.h
+
+#ifndef STIFF_EQUATIONS_H
+#define STIFF_EQUATIONS_H
+
+#include <vector>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include "differential_equations.h"
+
+namespace numeric {
+namespace ode {
+
+    /**
+     * @brief Jakobian prawej strony: zapisuje J[i][j] = d f_i / d y_j do macierzy n x n przygotowanej przez solver.
+     */
+    using JacobianFunction = std::function<void(double x, const std::vector<double>& y,
+                                                std::vector<std::vector<double>>& J)>;
+
+    /**
+     * @brief Ustawienia metod niejawnych.
+     * Pusty jacobian oznacza jakobian liczony roznicami skonczonymi (n dodatkowych wywolan f).
+     */
+    struct StiffOptions {
+        JacobianFunction jacobian;
+        double newton_tol = 1e-10;   // Wzgledna tolerancja poprawki Newtona (BDF)
+        int max_newton_iter = 7;     // Po przekroczeniu jakobian jest odswiezany (BDF)
+        int jacobian_reuse = 20;     // Liczba krokow z ta sama macierza W (Rosenbrock-W)
+    };
+
+    struct StiffSolution {
+        SystemSolution trajectory;
+        long long rhs_evaluations = 0;
+        long long jacobian_evaluations = 0;
+        long long factorizations = 0;
+        std::vector<int> orders;     // Rzad uzyty w kolejnych krokach (tylko BDF)
+    };
+
+    /**
+     * @brief Rozwiazuje sztywny uklad metoda BDF o stalym kroku h i zmiennym rzedzie od 1 do max_order (1-5).
+     * Calkowanie startuje od rzedu 1. Po kazdym kroku bledy lokalne rzedow k-1, k i k+1 sa szacowane
+     * z roznic wstecznych historii (beta_q / (q+1) * |nabla^{q+1} y|) i wybierany jest rzad o najmniejszym
+     * oszacowaniu, wiec niski rzad (lepsza stabilnosc) jest uzywany w stanach przejsciowych, a wysoki
+     * na gladkich odcinkach. Macierz iteracji I - h*beta*J jest rozkladana (LU z modulu linear_algebra)
+     * i uzywana przez wiele krokow; odswiezana jest dopiero, gdy iteracja Newtona przestaje zbiegac
+     * lub zmienia sie rzad.
+     * @return std::optional<StiffSolution> lub pusty, jesli Newton nie zbiega nawet ze swiezym jakobianem.
+     * @throws std::invalid_argument przy nieprawidlowych argumentach.
+     */
+    std::optional<StiffSolution> bdfSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                           double h, double x_end, int max_order = 5,
+                                           const StiffOptions& options = StiffOptions());
+
+    /**
+     * @brief Rozwiazuje sztywny uklad dwuetapowa metoda Rosenbrocka-W ROS2 (rzad 2, L-stabilna) o stalym kroku h.
+     * Jako metoda typu W nie wymaga dokladnego jakobianu, wiec rozklad W = I - gamma*h*J
+     * jest uzywany przez options.jacobian_reuse krokow.
+     * @return std::optional<StiffSolution> lub pusty, jesli macierz W jest osobliwa.
+     * @throws std::invalid_argument przy nieprawidlowych argumentach.
+     */
+    std::optional<StiffSolution> rosenbrockSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                                  double h, double x_end, const StiffOptions& options = StiffOptions());
+
+} // namespace ode
+} // namespace numeric
+
+#endif // STIFF_EQUATIONS_H
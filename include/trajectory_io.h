@@ -0,0 +1,176 @@
+// include/trajectory_io.h
+
+#ifndef TRAJECTORY_IO_H
+#define TRAJECTORY_IO_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <stdexcept>
+#include "differential_equations.h"
+
+namespace numeric {
+namespace ode {
+
+    /**
+     * Kolumnowy format binarny trajektorii (natywny porzadek bajtow):
+     *   naglowek (64 B): "NUMCPPTR", znacznik porzadku bajtow, wersja (1), wymiar, rozmiar elementu stanu (4 lub 8),
+     *   wiersze na porcje;
+     *   porcje: kolumna x (zawsze double), a po niej kolumny kolejnych skladowych stanu (kazda po rows elementow
+     *   w wybranej precyzji), uzupelnione zerami do wielokrotnosci 8 B;
+     *   indeks: dla kazdej porcji przesuniecie, liczba wierszy, pierwszy i ostatni x (double);
+     *   stopka (24 B): przesuniecie indeksu, liczba porcji, "NUMCPPEN".
+     * Precyzja Float32 dotyczy tylko stanu: x w float traci rozdzielczosc po okolo 7 cyfrach, co w dlugich
+     * przebiegach dawaloby powtorzone wartosci x.
+     * Kolumny sa wyrownane do rozmiaru elementu, wiec po zmapowaniu pliku mozna je czytac bez kopiowania.
+     */
+    enum class StoragePrecision { Float64, Float32 };
+
+    /**
+     * @brief Zapisuje trajektorie porcjami do strumienia binarnego (nie wymaga mozliwosci przewijania strumienia).
+     * Pamiec ograniczona jest do jednej porcji. Indeks i stopka zapisywane sa w finish() lub w destruktorze.
+     * Po bledzie zapisu writer przechodzi w stan bledu i kolejne append() oraz finish() rzucaja std::logic_error.
+     */
+    class TrajectoryWriter {
+    public:
+        /**
+         * @throws std::invalid_argument jesli dimension == 0 lub chunk_rows == 0.
+         */
+        TrajectoryWriter(std::ostream& out, std::size_t dimension,
+                         StoragePrecision precision = StoragePrecision::Float64, std::size_t chunk_rows = 4096);
+        ~TrajectoryWriter();
+
+        TrajectoryWriter(const TrajectoryWriter&) = delete;
+        TrajectoryWriter& operator=(const TrajectoryWriter&) = delete;
+
+        /**
+         * @brief Dopisuje punkt; y wskazuje dimension() wartosci.
+         * @throws std::logic_error po finish() lub wczesniejszym bledzie zapisu,
+         * std::runtime_error przy bledzie zapisu.
+         */
+        void append(double x, const double* y);
+        void append(double x, const std::vector<double>& y);
+
+        /**
+         * @brief Zapisuje niepelna porcje, indeks i stopke. Kolejne wywolania nic nie robia.
+         * @throws std::runtime_error przy bledzie zapisu, std::logic_error po wczesniejszym bledzie zapisu.
+         */
+        void finish();
+
+        /**
+         * @brief Obserwatorzy zapisujacy kazdy punkt rozwiazania; wersja skalarna wymaga dimension() == 1.
+         * Writer musi zyc dluzej niz zwrocony obserwator.
+         */
+        SystemObserver observer();
+        Observer scalarObserver();
+
+        std::size_t dimension() const { return dimension_; }
+        std::size_t rows() const { return total_rows_; }
+
+    private:
+        struct IndexEntry {
+            std::uint64_t offset;
+            std::uint64_t rows;
+            double x_first;
+            double x_last;
+        };
+
+        void flushChunk();
+        void writeBytes(const void* data, std::size_t size);
+        void writeColumn(const double* values, std::size_t count);
+
+        std::ostream& out_;
+        std::size_t dimension_;
+        std::size_t element_size_;
+        std::size_t chunk_rows_;
+        std::size_t buffered_ = 0;
+        std::size_t total_rows_ = 0;
+        std::uint64_t offset_ = 0;
+        bool finished_ = false;
+        bool failed_ = false;
+        std::vector<double> x_buffer_;
+        std::vector<double> y_buffer_;     // Kolumnowo: skladowa k zajmuje [k * chunk_rows, (k + 1) * chunk_rows)
+        std::vector<float> float_buffer_;
+        std::vector<IndexEntry> index_;
+    };
+
+    /**
+     * @brief Odczytuje plik trajektorii przez mapowanie pamieci (mmap / MapViewOfFile) bez kopiowania danych.
+     * Wskazniki zwracane przez xColumn i stateColumn sa wazne, dopoki zyje obiekt czytnika.
+     */
+    class TrajectoryReader {
+    public:
+        /**
+         * @throws std::runtime_error jesli pliku nie mozna zmapowac lub ma nieprawidlowy format.
+         */
+        explicit TrajectoryReader(const std::string& path);
+        ~TrajectoryReader();
+
+        TrajectoryReader(TrajectoryReader&& other) noexcept;
+        TrajectoryReader& operator=(TrajectoryReader&& other) noexcept;
+        TrajectoryReader(const TrajectoryReader&) = delete;
+        TrajectoryReader& operator=(const TrajectoryReader&) = delete;
+
+        std::size_t dimension() const { return dimension_; }
+        std::size_t rows() const { return rows_; }
+        std::size_t chunkCount() const { return chunk_count_; }
+        // Precyzja kolumn stanu; kolumna x jest zawsze zapisywana jako double
+        StoragePrecision precision() const { return element_size_ == 4 ? StoragePrecision::Float32 : StoragePrecision::Float64; }
+
+        std::size_t chunkRows(std::size_t chunk) const;
+        double chunkFirstX(std::size_t chunk) const;
+        double chunkLastX(std::size_t chunk) const;
+
+        /**
+         * @brief Indeks porcji zawierajacej ostatni punkt o wspolrzednej <= x (wyszukiwanie binarne w indeksie,
+         * dla rosnacego x).
+         * @throws std::invalid_argument jesli x lezy poza zakresem trajektorii.
+         */
+        std::size_t findChunk(double x) const;
+
+        /**
+         * @brief Kolumny porcji bez kopiowania. Dla xColumn T to double, dla stateColumn T musi odpowiadac
+         * precision() (double lub float).
+         * @throws std::invalid_argument przy niezgodnym typie lub indeksie poza zakresem.
+         */
+        template <typename T>
+        const T* xColumn(std::size_t chunk) const {
+            return static_cast<const T*>(column(chunk, 0, sizeof(T)));
+        }
+        template <typename T>
+        const T* stateColumn(std::size_t chunk, std::size_t component) const {
+            return static_cast<const T*>(column(chunk, component + 1, sizeof(T)));
+        }
+
+        /**
+         * @brief Dostep do pojedynczych wartosci (z konwersja do double) i kopiowanie calych kolumn.
+         * @throws std::invalid_argument przy indeksie poza zakresem.
+         */
+        double x(std::size_t row) const;
+        double state(std::size_t row, std::size_t component) const;
+        std::vector<double> xValues() const;
+        std::vector<double> component(std::size_t component) const;
+
+    private:
+        const void* column(std::size_t chunk, std::size_t column, std::size_t element_size) const;
+        double value(std::size_t row, std::size_t column) const;
+        void release() noexcept;
+
+        const unsigned char* data_ = nullptr;
+        std::size_t size_ = 0;
+        void* file_handle_ = nullptr;     // Uzywane tylko w systemie Windows
+        void* mapping_handle_ = nullptr;
+        std::size_t dimension_ = 0;
+        std::size_t element_size_ = 8;
+        std::size_t chunk_capacity_ = 0;
+        std::size_t chunk_count_ = 0;
+        std::size_t rows_ = 0;
+        const unsigned char* index_ = nullptr;
+    };
+
+} // namespace ode
+} // namespace numeric
+
+#endif // TRAJECTORY_IO_H
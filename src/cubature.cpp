@@ -0,0 +1,409 @@
+// src/cubature.cpp
+
+#include "cubature.h"
+#include "parallel.h"
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <random>
+#include <algorithm>
+
+namespace numeric {
+namespace cubature {
+
+namespace { // Anonimowa przestrzen nazw dla funkcji pomocniczych
+
+    const double kPi = 3.14159265358979323846;
+
+    void validateBox(const MultiFunction& f, const std::vector<double>& lower, const std::vector<double>& upper) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie moze byc pusta.");
+        }
+        if (lower.empty() || lower.size() != upper.size()) {
+            throw std::invalid_argument("Granice musza miec ten sam, niezerowy rozmiar.");
+        }
+    }
+
+    struct GaussRule {
+        std::vector<double> x;
+        std::vector<double> w;
+    };
+
+    // Wezly i wagi Gaussa-Legendre'a dowolnego rzedu na [-1, 1] (metoda Newtona dla P_n), z pamiecia podreczna
+    const GaussRule& gaussLegendreRule(int n) {
+        static std::map<int, GaussRule> cache;
+        static std::mutex cache_mutex;
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache.find(n);
+        if (it != cache.end()) {
+            return it->second;
+        }
+
+        GaussRule rule;
+        rule.x.resize(n);
+        rule.w.resize(n);
+        for (int i = 0; i < (n + 1) / 2; ++i) {
+            double z = std::cos(kPi * (i + 0.75) / (n + 0.5));
+            double dp = 0.0;
+            for (int iter = 0; iter < 100; ++iter) {
+                double p0 = 1.0, p1 = 0.0;
+                for (int k = 1; k <= n; ++k) {
+                    double p2 = p1;
+                    p1 = p0;
+                    p0 = ((2.0 * k - 1.0) * z * p1 - (k - 1.0) * p2) / k;
+                }
+                dp = n * (z * p0 - p1) / (z * z - 1.0);
+                double dz = p0 / dp;
+                z -= dz;
+                if (std::abs(dz) < 1e-15) {
+                    break;
+                }
+            }
+            double w = 2.0 / ((1.0 - z * z) * dp * dp);
+            rule.x[i] = -z;
+            rule.x[n - 1 - i] = z;
+            rule.w[i] = w;
+            rule.w[n - 1 - i] = w;
+        }
+        return cache.emplace(n, std::move(rule)).first->second;
+    }
+
+    double tensorSum(const MultiFunction& f, const std::vector<double>& lower, const std::vector<double>& upper,
+                     int nodes, long long& evaluations) {
+        const GaussRule& rule = gaussLegendreRule(nodes);
+        const std::size_t d = lower.size();
+        std::vector<int> index(d, 0);
+        std::vector<double> point(d);
+        double jacobian = 1.0;
+        for (std::size_t k = 0; k < d; ++k) {
+            jacobian *= (upper[k] - lower[k]) / 2.0;
+        }
+
+        double sum = 0.0;
+        while (true) {
+            double weight = 1.0;
+            for (std::size_t k = 0; k < d; ++k) {
+                double c1 = (upper[k] - lower[k]) / 2.0;
+                double c2 = (upper[k] + lower[k]) / 2.0;
+                point[k] = c1 * rule.x[index[k]] + c2;
+                weight *= rule.w[index[k]];
+            }
+            sum += weight * f(point);
+            ++evaluations;
+
+            // Licznik "odometr" po wszystkich kombinacjach wezlow
+            std::size_t k = 0;
+            while (k < d && ++index[k] == nodes) {
+                index[k] = 0;
+                ++k;
+            }
+            if (k == d) {
+                break;
+            }
+        }
+        return jacobian * sum;
+    }
+
+    // Liczba punktow reguly Clenshawa-Curtisa o indeksie i >= 1 (reguly zagniezdzone)
+    int ccPoints(int i) {
+        return i == 1 ? 1 : (1 << (i - 1)) + 1;
+    }
+
+    // Wagi Clenshawa-Curtisa dla m punktow x_j = cos(pi * j / (m - 1)) na [-1, 1]
+    std::vector<double> ccWeights(int m) {
+        if (m == 1) {
+            return { 2.0 };
+        }
+        const int n = m - 1;
+        std::vector<double> w(m);
+        for (int j = 0; j <= n; ++j) {
+            double s = 0.0;
+            for (int k = 1; k <= n / 2; ++k) {
+                double b = (2 * k == n) ? 1.0 : 2.0;
+                s += b / (4.0 * k * k - 1.0) * std::cos(2.0 * k * j * kPi / n);
+            }
+            double c = (j == 0 || j == n) ? 1.0 : 2.0;
+            w[j] = c / n * (1.0 - s);
+        }
+        return w;
+    }
+
+    double binomial(int n, int k) {
+        double r = 1.0;
+        for (int i = 1; i <= k; ++i) {
+            r = r * (n - k + i) / i;
+        }
+        return r;
+    }
+
+    // Dodaje wklad siatki Smolyaka poziomu `level` do wag punktow; punkty sa kluczowane
+    // indeksami na najdrobniejszej siatce o 2^finest + 1 punktach, co pozwala wspoldzielic je miedzy poziomami.
+    void accumulateSmolyak(int d, int level, int finest, double scale,
+                           std::map<std::vector<int>, double>& weights) {
+        const int max_index = level + 1;
+        std::vector<int> multi(d, 1);
+        std::vector<int> point(d);
+        const int n_finest = 1 << finest;
+
+        // Rekurencyjne przejscie po indeksach wielowymiarowych z |i| - d w [level - d + 1, level]
+        std::function<void(int, int)> visit = [&](int k, int used) {
+            if (k == d) {
+                int excess = level - used;
+                if (excess < 0 || excess > d - 1) {
+                    return;
+                }
+                double coeff = ((excess % 2 == 0) ? 1.0 : -1.0) * binomial(d - 1, excess) * scale;
+                std::vector<std::vector<double>> w(d);
+                for (int j = 0; j < d; ++j) {
+                    w[j] = ccWeights(ccPoints(multi[j]));
+                }
+                std::vector<int> idx(d, 0);
+                while (true) {
+                    double weight = coeff;
+                    for (int j = 0; j < d; ++j) {
+                        int m = ccPoints(multi[j]);
+                        point[j] = (m == 1) ? n_finest / 2 : idx[j] * (n_finest / (m - 1));
+                        weight *= w[j][idx[j]];
+                    }
+                    weights[point] += weight;
+
+                    int j = 0;
+                    while (j < d && ++idx[j] == ccPoints(multi[j])) {
+                        idx[j] = 0;
+                        ++j;
+                    }
+                    if (j == d) {
+                        break;
+                    }
+                }
+                return;
+            }
+            for (int i = 1; i <= max_index && used + (i - 1) <= level; ++i) {
+                multi[k] = i;
+                visit(k + 1, used + (i - 1));
+            }
+            multi[k] = 1;
+        };
+        visit(0, 0);
+    }
+
+    // Liczby kierunkowe Sobola (Joe i Kuo) dla wymiarow 2..21: stopien s, wspolczynniki a, poczatkowe m_i
+    struct SobolPoly {
+        int s;
+        unsigned a;
+        unsigned m[7];
+    };
+    const SobolPoly kSobolPolys[] = {
+        { 1, 0,  { 1 } },
+        { 2, 1,  { 1, 3 } },
+        { 3, 1,  { 1, 3, 1 } },
+        { 3, 2,  { 1, 1, 1 } },
+        { 4, 1,  { 1, 1, 3, 3 } },
+        { 4, 4,  { 1, 3, 5, 13 } },
+        { 5, 2,  { 1, 1, 5, 5, 17 } },
+        { 5, 4,  { 1, 1, 5, 5, 5 } },
+        { 5, 7,  { 1, 1, 7, 11, 19 } },
+        { 5, 11, { 1, 1, 5, 1, 1 } },
+        { 5, 13, { 1, 1, 1, 3, 11 } },
+        { 5, 14, { 1, 3, 5, 5, 31 } },
+        { 6, 1,  { 1, 3, 3, 9, 7, 49 } },
+        { 6, 13, { 1, 1, 1, 15, 21, 21 } },
+        { 6, 16, { 1, 3, 1, 13, 27, 49 } },
+        { 6, 19, { 1, 1, 1, 15, 7, 5 } },
+        { 6, 22, { 1, 3, 1, 15, 13, 25 } },
+        { 6, 25, { 1, 1, 5, 5, 19, 61 } },
+        { 7, 1,  { 1, 3, 7, 11, 23, 15, 103 } },
+        { 7, 4,  { 1, 3, 7, 13, 13, 15, 69 } },
+    };
+    const std::size_t kMaxSobolDimension = 1 + sizeof(kSobolPolys) / sizeof(kSobolPolys[0]);
+    const int kSobolBits = 32;
+
+    std::vector<std::uint32_t> sobolDirections(std::size_t dim) {
+        std::vector<std::uint32_t> v(kSobolBits);
+        if (dim == 0) {
+            for (int k = 0; k < kSobolBits; ++k) {
+                v[k] = std::uint32_t(1) << (kSobolBits - 1 - k);
+            }
+            return v;
+        }
+        const SobolPoly& p = kSobolPolys[dim - 1];
+        std::vector<std::uint32_t> m(kSobolBits);
+        for (int k = 0; k < kSobolBits; ++k) {
+            if (k < p.s) {
+                m[k] = p.m[k];
+                continue;
+            }
+            std::uint32_t value = m[k - p.s] ^ (m[k - p.s] << p.s);
+            for (int j = 1; j < p.s; ++j) {
+                if ((p.a >> (p.s - 1 - j)) & 1u) {
+                    value ^= m[k - j] << j;
+                }
+            }
+            m[k] = value;
+        }
+        for (int k = 0; k < kSobolBits; ++k) {
+            v[k] = m[k] << (kSobolBits - 1 - k);
+        }
+        return v;
+    }
+
+    bool parity(std::uint32_t x) {
+        x ^= x >> 16;
+        x ^= x >> 8;
+        x ^= x >> 4;
+        x ^= x >> 2;
+        x ^= x >> 1;
+        return (x & 1u) != 0;
+    }
+
+    // Jedna replika: skramblowane liczby kierunkowe (L * v) i przesuniecie cyfrowe
+    double sobolReplicate(const MultiFunction& f, const std::vector<double>& lower,
+                          const std::vector<double>& upper, long long samples, std::uint64_t seed) {
+        const std::size_t d = lower.size();
+        std::mt19937_64 rng(seed);
+        std::vector<std::vector<std::uint32_t>> directions(d);
+        std::vector<std::uint32_t> state(d);
+        for (std::size_t k = 0; k < d; ++k) {
+            // Losowa dolnotrojkatna macierz binarna z jedynkami na diagonali (bit 31 to najstarsza cyfra)
+            std::uint32_t rows[kSobolBits];
+            for (int r = 0; r < kSobolBits; ++r) {
+                std::uint32_t own = std::uint32_t(1) << (kSobolBits - 1 - r);
+                std::uint32_t higher = ~((own << 1) - 1u);
+                if (r == 0) {
+                    higher = 0;
+                }
+                rows[r] = own | (static_cast<std::uint32_t>(rng()) & higher);
+            }
+            std::vector<std::uint32_t> v = sobolDirections(k);
+            for (int b = 0; b < kSobolBits; ++b) {
+                std::uint32_t scrambled = 0;
+                for (int r = 0; r < kSobolBits; ++r) {
+                    if (parity(rows[r] & v[b])) {
+                        scrambled |= std::uint32_t(1) << (kSobolBits - 1 - r);
+                    }
+                }
+                v[b] = scrambled;
+            }
+            directions[k] = std::move(v);
+            state[k] = static_cast<std::uint32_t>(rng());
+        }
+
+        const double to_unit = 1.0 / 4294967296.0;
+        std::vector<double> point(d);
+        double sum = 0.0;
+        for (long long n = 0; n < samples; ++n) {
+            if (n > 0) {
+                // Kolejnosc Graya: zmienia sie bit odpowiadajacy najmlodszej zerowej cyfrze n - 1
+                int c = 0;
+                unsigned long long value = static_cast<unsigned long long>(n - 1);
+                while (value & 1ull) {
+                    value >>= 1;
+                    ++c;
+                }
+                for (std::size_t k = 0; k < d; ++k) {
+                    state[k] ^= directions[k][c];
+                }
+            }
+            for (std::size_t k = 0; k < d; ++k) {
+                double u = (static_cast<double>(state[k]) + 0.5) * to_unit;
+                point[k] = lower[k] + (upper[k] - lower[k]) * u;
+            }
+            sum += f(point);
+        }
+
+        double volume = 1.0;
+        for (std::size_t k = 0; k < d; ++k) {
+            volume *= upper[k] - lower[k];
+        }
+        return volume * sum / static_cast<double>(samples);
+    }
+
+} // Koniec anonimowej przestrzeni nazw
+
+CubatureResult tensorGaussLegendre(const MultiFunction& f, const std::vector<double>& lower,
+                                   const std::vector<double>& upper, int nodes) {
+    validateBox(f, lower, upper);
+    if (nodes < 2) {
+        throw std::invalid_argument("Liczba wezlow musi byc co najmniej rowna 2.");
+    }
+    long long evaluations = 0;
+    double value = tensorSum(f, lower, upper, nodes, evaluations);
+    double coarse = tensorSum(f, lower, upper, nodes - 1, evaluations);
+    return { value, std::abs(value - coarse), evaluations };
+}
+
+CubatureResult sparseGridIntegration(const MultiFunction& f, const std::vector<double>& lower,
+                                     const std::vector<double>& upper, int level) {
+    validateBox(f, lower, upper);
+    if (level < 1 || level > 12) {
+        throw std::invalid_argument("Poziom siatki rzadkiej musi nalezec do przedzialu [1, 12].");
+    }
+    const int d = static_cast<int>(lower.size());
+
+    // Wagi obu poziomow na wspolnym zbiorze punktow, a roznica poziomow daje oszacowanie bledu
+    std::map<std::vector<int>, double> fine, coarse;
+    accumulateSmolyak(d, level, level, 1.0, fine);
+    accumulateSmolyak(d, level - 1, level, 1.0, coarse);
+
+    const int n_finest = 1 << level;
+    std::vector<double> point(d);
+    double value = 0.0, coarse_value = 0.0;
+    long long evaluations = 0;
+    for (const auto& entry : fine) {
+        for (int k = 0; k < d; ++k) {
+            double t = std::cos(kPi * (static_cast<double>(entry.first[k]) / n_finest));
+            point[k] = 0.5 * (upper[k] - lower[k]) * t + 0.5 * (upper[k] + lower[k]);
+        }
+        double fx = f(point);
+        ++evaluations;
+        value += entry.second * fx;
+        auto it = coarse.find(entry.first);
+        if (it != coarse.end()) {
+            coarse_value += it->second * fx;
+        }
+    }
+
+    double jacobian = 1.0;
+    for (int k = 0; k < d; ++k) {
+        jacobian *= (upper[k] - lower[k]) / 2.0;
+    }
+    value *= jacobian;
+    coarse_value *= jacobian;
+    return { value, std::abs(value - coarse_value), evaluations };
+}
+
+CubatureResult sobolQuasiMonteCarlo(const MultiFunction& f, const std::vector<double>& lower,
+                                    const std::vector<double>& upper, long long samples,
+                                    int replicates, std::uint64_t seed, int threads) {
+    validateBox(f, lower, upper);
+    if (lower.size() > kMaxSobolDimension) {
+        throw std::invalid_argument("Przekroczono maksymalny obslugiwany wymiar ciagu Sobola.");
+    }
+    if (samples <= 0 || samples > 0xFFFFFFFFll) {
+        throw std::invalid_argument("Liczba probek musi nalezec do przedzialu [1, 2^32 - 1].");
+    }
+    if (replicates < 2 || threads <= 0) {
+        throw std::invalid_argument("Wymagane sa co najmniej 2 repliki i dodatnia liczba watkow.");
+    }
+
+    std::vector<double> estimates(replicates);
+    // Niezalezne strumienie: kazda replika ma wlasne skramblowanie; wyjatek z f trafia do wywolujacego
+    parallel::parallelFor(static_cast<std::size_t>(replicates), threads, [&](std::size_t r, std::size_t) {
+        estimates[r] = sobolReplicate(f, lower, upper, samples, seed * 0x9E3779B97F4A7C15ull + r);
+    });
+
+    double mean = 0.0;
+    for (double e : estimates) {
+        mean += e;
+    }
+    mean /= replicates;
+    double variance = 0.0;
+    for (double e : estimates) {
+        variance += (e - mean) * (e - mean);
+    }
+    variance /= (replicates - 1);
+    return { mean, std::sqrt(variance / replicates), samples * replicates };
+}
+
+} // namespace cubature
+} // namespace numeric
@@ -1,8 +1,15 @@
 // src/differential_equations.cpp
 
 #include "differential_equations.h"
+#include "runge_kutta.h"
+#include "nonlinear_equations.h"
+#include "parallel.h"
 #include <cmath>
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <stdexcept>
+#include <chrono>
 
 namespace numeric {
 namespace ode {
@@ -20,84 +27,1218 @@ namespace { // Anonimowa przestrzen nazw dla funkcji pomocniczych
             throw std::invalid_argument("Punkt koncowy (x_end) nie moze byc mniejszy od punktu poczatkowego (x0).");
         }
     }
+
+    void validateSystemInputs(const OdeSystemFunction& f, const std::vector<double>& y0, double h, double x0, double x_end) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie jest zdefiniowana (jest pusta).");
+        }
+        if (y0.empty()) {
+            throw std::invalid_argument("Wektor stanu poczatkowego (y0) nie moze byc pusty.");
+        }
+        if (h <= 0) {
+            throw std::invalid_argument("Krok calkowania (h) musi byc dodatni.");
+        }
+        if (x_end < x0) {
+            throw std::invalid_argument("Punkt koncowy (x_end) nie moze byc mniejszy od punktu poczatkowego (x0).");
+        }
+    }
+
+    // Liczba krokow tak, aby x0 + n*h <= x_end (z tolerancja na bledy zaokraglen)
+    std::size_t stepCount(double x0, double h, double x_end) {
+        return static_cast<std::size_t>(std::floor((x_end - x0) / h + 1e-9));
+    }
 } // Koniec anonimowej przestrzeni nazw
 
-std::vector<SolutionPoint> eulerMethod(
-    const OdeFunction& f, double x0, double y0, double h, double x_end) {
-    
-    validateInputs(f, h, x0, x_end); // Walidacja na poczatku
-    std::vector<SolutionPoint> results;
-    double x = x0;
-    double y = y0;
+// === Metody skalarne: rdzen z obserwatorem, wersje zwracajace wektor zbieraja punkty ===
 
-    while (x <= x_end) {
-        results.push_back({x, y});
-        y = y + h * f(x, y);
-        x = x + h;
+namespace {
+    void validateObserver(bool has_observer) {
+        if (!has_observer) {
+            throw std::invalid_argument("Obserwator nie jest zdefiniowany (jest pusty).");
+        }
     }
-    
-    return results;
+
+    // Zbiera pelna trajektorie do wektora o rozmiarze zarezerwowanym z gory
+    using ScalarMethod = void (*)(const OdeFunction&, double, double, double, double, const Observer&);
+
+    std::vector<SolutionPoint> collectScalar(const OdeFunction& f, double x0, double y0, double h, double x_end,
+                                             ScalarMethod method) {
+        validateInputs(f, h, x0, x_end);
+        std::vector<SolutionPoint> results;
+        results.reserve(stepCount(x0, h, x_end) + 2);
+        method(f, x0, y0, h, x_end, [&results](double x, double y) { results.push_back({x, y}); });
+        return results;
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+void eulerMethod(const OdeFunction& f, double x0, double y0, double h, double x_end, const Observer& observer) {
+    validateInputs(f, h, x0, x_end);
+    validateObserver(static_cast<bool>(observer));
+    explicitRungeKutta<EulerTableau>(f, x0, y0, h, x_end, observer);
+}
+
+void heunMethod(const OdeFunction& f, double x0, double y0, double h, double x_end, const Observer& observer) {
+    validateInputs(f, h, x0, x_end);
+    validateObserver(static_cast<bool>(observer));
+    explicitRungeKutta<HeunTableau>(f, x0, y0, h, x_end, observer);
+}
+
+void midpointMethod(const OdeFunction& f, double x0, double y0, double h, double x_end, const Observer& observer) {
+    validateInputs(f, h, x0, x_end);
+    validateObserver(static_cast<bool>(observer));
+    explicitRungeKutta<MidpointTableau>(f, x0, y0, h, x_end, observer);
+}
+
+void rungeKutta4(const OdeFunction& f, double x0, double y0, double h, double x_end, const Observer& observer) {
+    validateInputs(f, h, x0, x_end);
+    validateObserver(static_cast<bool>(observer));
+    explicitRungeKutta<Rk4Tableau>(f, x0, y0, h, x_end, observer);
+}
+
+std::vector<SolutionPoint> eulerMethod(
+    const OdeFunction& f, double x0, double y0, double h, double x_end) {
+    return collectScalar(f, x0, y0, h, x_end, eulerMethod);
 }
 
 std::vector<SolutionPoint> heunMethod(
     const OdeFunction& f, double x0, double y0, double h, double x_end) {
-    
-    validateInputs(f, h, x0, x_end); // Walidacja na poczatku
-    std::vector<SolutionPoint> results;
-    double x = x0;
-    double y = y0;
+    return collectScalar(f, x0, y0, h, x_end, heunMethod);
+}
 
-    while (x <= x_end) {
-        results.push_back({x, y});
-        double k1 = f(x, y);
-        double y_pred = y + h * k1;
-        double k2 = f(x + h, y_pred);
-        y = y + (h / 2.0) * (k1 + k2);
-        x = x + h;
+std::vector<SolutionPoint> midpointMethod(
+    const OdeFunction& f, double x0, double y0, double h, double x_end) {
+    return collectScalar(f, x0, y0, h, x_end, midpointMethod);
+}
+
+std::vector<SolutionPoint> rungeKutta4(
+    const OdeFunction& f, double x0, double y0, double h, double x_end) {
+    return collectScalar(f, x0, y0, h, x_end, rungeKutta4);
+}
+
+// === Uklady rownan ===
+
+void eulerSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                 const SystemObserver& observer) {
+    validateSystemInputs(f, y0, h, x0, x_end);
+    validateObserver(static_cast<bool>(observer));
+    explicitRungeKuttaSystem<EulerTableau>(f, x0, y0, h, x_end, observer);
+}
+
+void heunSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                const SystemObserver& observer) {
+    validateSystemInputs(f, y0, h, x0, x_end);
+    validateObserver(static_cast<bool>(observer));
+    explicitRungeKuttaSystem<HeunTableau>(f, x0, y0, h, x_end, observer);
+}
+
+void midpointSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                    const SystemObserver& observer) {
+    validateSystemInputs(f, y0, h, x0, x_end);
+    validateObserver(static_cast<bool>(observer));
+    explicitRungeKuttaSystem<MidpointTableau>(f, x0, y0, h, x_end, observer);
+}
+
+void rungeKutta4System(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                       const SystemObserver& observer) {
+    validateSystemInputs(f, y0, h, x0, x_end);
+    validateObserver(static_cast<bool>(observer));
+    explicitRungeKuttaSystem<Rk4Tableau>(f, x0, y0, h, x_end, observer);
+}
+
+namespace {
+    // Zbiera pelna trajektorie ukladu do SystemSolution o rozmiarze zarezerwowanym z gory
+    using SystemMethod = void (*)(const OdeSystemFunction&, double, const std::vector<double>&, double, double,
+                                  const SystemObserver&);
+
+    SystemSolution collectSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h,
+                                 double x_end, SystemMethod method) {
+        validateSystemInputs(f, y0, h, x0, x_end);
+        SystemSolution solution;
+        solution.dimension = y0.size();
+        const std::size_t points = stepCount(x0, h, x_end) + 1;
+        solution.x.reserve(points);
+        solution.y.reserve(points * y0.size());
+        method(f, x0, y0, h, x_end, [&solution](double x, const std::vector<double>& y) {
+            solution.x.push_back(x);
+            solution.y.insert(solution.y.end(), y.begin(), y.end());
+        });
+        return solution;
     }
+} // Koniec anonimowej przestrzeni nazw
 
-    return results;
+SystemSolution eulerSystem(
+    const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end) {
+    return collectSystem(f, x0, y0, h, x_end, eulerSystem);
 }
 
-std::vector<SolutionPoint> midpointMethod(
-    const OdeFunction& f, double x0, double y0, double h, double x_end) {
-    
-    validateInputs(f, h, x0, x_end); // Walidacja na poczatku
-    std::vector<SolutionPoint> results;
-    double x = x0;
-    double y = y0;
+SystemSolution heunSystem(
+    const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end) {
+    return collectSystem(f, x0, y0, h, x_end, heunSystem);
+}
+
+SystemSolution midpointSystem(
+    const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end) {
+    return collectSystem(f, x0, y0, h, x_end, midpointSystem);
+}
+
+SystemSolution rungeKutta4System(
+    const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end) {
+    return collectSystem(f, x0, y0, h, x_end, rungeKutta4System);
+}
 
-    while (x <= x_end) {
-        results.push_back({x, y});
-        double k1 = f(x, y);
-        double y_mid = y + (h / 2.0) * k1;
-        double k2 = f(x + h / 2.0, y_mid);
-        y = y + h * k2;
-        x = x + h;
+// === Wbudowani obserwatorzy ===
+
+namespace {
+    double hermite(double theta, double h, double y0, double f0, double y1, double f1) {
+        double t2 = theta * theta, t3 = t2 * theta;
+        return (2.0 * t3 - 3.0 * t2 + 1.0) * y0 + (t3 - 2.0 * t2 + theta) * h * f0
+             + (-2.0 * t3 + 3.0 * t2) * y1 + (t3 - t2) * h * f1;
+    }
+
+    std::vector<double> sortedPoints(std::vector<double> points) {
+        std::sort(points.begin(), points.end());
+        return points;
+    }
+
+    void validateStride(std::size_t stride) {
+        if (stride == 0) {
+            throw std::invalid_argument("Krok decymacji (stride) musi byc dodatni.");
+        }
     }
+} // Koniec anonimowej przestrzeni nazw
 
-    return results;
+Observer finalStateObserver(SolutionPoint& last) {
+    return [&last](double x, double y) { last = {x, y}; };
 }
 
-std::vector<SolutionPoint> rungeKutta4(
-    const OdeFunction& f, double x0, double y0, double h, double x_end) {
-    
-    validateInputs(f, h, x0, x_end); // Walidacja na poczatku
-    std::vector<SolutionPoint> results;
+Observer strideObserver(std::size_t stride, std::vector<SolutionPoint>& out) {
+    validateStride(stride);
+    auto counter = std::make_shared<std::size_t>(0);
+    return [stride, &out, counter](double x, double y) {
+        if ((*counter)++ % stride == 0) {
+            out.push_back({x, y});
+        }
+    };
+}
+
+Observer outputAtObserver(const OdeFunction& f, std::vector<double> points, std::vector<SolutionPoint>& out) {
+    if (!f) {
+        throw std::invalid_argument("Funkcja f nie jest zdefiniowana (jest pusta).");
+    }
+    struct State {
+        std::vector<double> points;
+        std::size_t next = 0;
+        bool has_prev = false;
+        double x_prev = 0.0, y_prev = 0.0;
+    };
+    auto state = std::make_shared<State>();
+    state->points = sortedPoints(std::move(points));
+    out.reserve(out.size() + state->points.size());
+    return [f, &out, state](double x, double y) {
+        State& st = *state;
+        if (!st.has_prev) {
+            // Punkty przed poczatkiem rozwiazania sa pomijane
+            while (st.next < st.points.size() && st.points[st.next] < x) ++st.next;
+        }
+        bool derivatives_ready = false;
+        double f_prev = 0.0, f_curr = 0.0;
+        while (st.next < st.points.size() && st.points[st.next] <= x) {
+            double t = st.points[st.next++];
+            if (t == x || !st.has_prev) {
+                out.push_back({t, y});
+                continue;
+            }
+            if (!derivatives_ready) {
+                f_prev = f(st.x_prev, st.y_prev);
+                f_curr = f(x, y);
+                derivatives_ready = true;
+            }
+            double h = x - st.x_prev;
+            out.push_back({t, hermite((t - st.x_prev) / h, h, st.y_prev, f_prev, y, f_curr)});
+        }
+        st.has_prev = true;
+        st.x_prev = x;
+        st.y_prev = y;
+    };
+}
+
+SystemObserver finalStateObserver(SystemSolutionPoint& last) {
+    return [&last](double x, const std::vector<double>& y) {
+        last.x = x;
+        last.y.assign(y.begin(), y.end()); // Bez alokacji po pierwszym wywolaniu
+    };
+}
+
+SystemObserver strideObserver(std::size_t stride, SystemSolution& out) {
+    validateStride(stride);
+    auto counter = std::make_shared<std::size_t>(0);
+    return [stride, &out, counter](double x, const std::vector<double>& y) {
+        if ((*counter)++ % stride == 0) {
+            out.dimension = y.size();
+            out.x.push_back(x);
+            out.y.insert(out.y.end(), y.begin(), y.end());
+        }
+    };
+}
+
+SystemObserver outputAtObserver(const OdeSystemFunction& f, std::vector<double> points, SystemSolution& out) {
+    if (!f) {
+        throw std::invalid_argument("Funkcja f nie jest zdefiniowana (jest pusta).");
+    }
+    struct State {
+        std::vector<double> points;
+        std::size_t next = 0;
+        bool has_prev = false;
+        double x_prev = 0.0;
+        std::vector<double> y_prev, f_prev, f_curr;
+    };
+    auto state = std::make_shared<State>();
+    state->points = sortedPoints(std::move(points));
+    out.x.reserve(out.x.size() + state->points.size());
+    return [f, &out, state](double x, const std::vector<double>& y) {
+        State& st = *state;
+        const std::size_t n = y.size();
+        if (!st.has_prev) {
+            st.y_prev.resize(n);
+            st.f_prev.resize(n);
+            st.f_curr.resize(n);
+            out.dimension = n;
+            out.y.reserve(out.y.size() + st.points.size() * n);
+            while (st.next < st.points.size() && st.points[st.next] < x) ++st.next;
+        }
+        bool derivatives_ready = false;
+        while (st.next < st.points.size() && st.points[st.next] <= x) {
+            double t = st.points[st.next++];
+            out.x.push_back(t);
+            if (t == x || !st.has_prev) {
+                out.y.insert(out.y.end(), y.begin(), y.end());
+                continue;
+            }
+            if (!derivatives_ready) {
+                f(st.x_prev, st.y_prev, st.f_prev);
+                f(x, y, st.f_curr);
+                derivatives_ready = true;
+            }
+            double h = x - st.x_prev;
+            double theta = (t - st.x_prev) / h;
+            for (std::size_t i = 0; i < n; ++i) {
+                out.y.push_back(hermite(theta, h, st.y_prev[i], st.f_prev[i], y[i], st.f_curr[i]));
+            }
+        }
+        st.has_prev = true;
+        st.x_prev = x;
+        std::copy(y.begin(), y.end(), st.y_prev.begin());
+    };
+}
+
+void DenseOutput::reset(std::size_t dimension, double x0) {
+    dimension_ = dimension;
+    x_.assign(1, x0);
+    coeffs_.clear();
+}
+
+void DenseOutput::appendStep(double x_next, const double* r) {
+    x_.push_back(x_next);
+    coeffs_.insert(coeffs_.end(), r, r + 5 * dimension_);
+}
+
+// === Rozwiazanie ciagle i zdarzenia ===
+
+namespace {
+    // Interpolant kroku: r0 + t * (r1 + (1 - t) * (r2 + t * (r3 + (1 - t) * r4))), t = (x - x_k) / h
+    void evaluateDenseStep(const double* r, std::size_t n, double theta, double* y) {
+        const double theta1 = 1.0 - theta;
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] = r[i] + theta * (r[n + i] + theta1 * (r[2 * n + i] + theta * (r[3 * n + i] + theta1 * r[4 * n + i])));
+        }
+    }
+
+    // Wspolczynniki interpolantu Hermite'a (r4 = 0) z wartosci i pochodnych na koncach kroku dlugosci h
+    void hermiteDenseStep(std::size_t n, double h, const double* y0, const double* f0, const double* y1,
+                          const double* f1, double* r) {
+        for (std::size_t i = 0; i < n; ++i) {
+            double diff = y1[i] - y0[i];
+            double bspl = h * f0[i] - diff;
+            r[i] = y0[i];
+            r[n + i] = diff;
+            r[2 * n + i] = bspl;
+            r[3 * n + i] = diff - h * f1[i] - bspl;
+            r[4 * n + i] = 0.0;
+        }
+    }
+
+    void validateEvents(const std::vector<OdeEvent>& events, double event_tol) {
+        for (const auto& event : events) {
+            if (!event.g) {
+                throw std::invalid_argument("Funkcja zdarzenia g nie jest zdefiniowana (jest pusta).");
+            }
+        }
+        if (event_tol <= 0) {
+            throw std::invalid_argument("Dokladnosc polozenia zdarzenia musi byc dodatnia.");
+        }
+    }
+
+    // Sledzi znaki funkcji zdarzen miedzy kolejnymi punktami rozwiazania
+    class EventMonitor {
+    public:
+        EventMonitor(const std::vector<OdeEvent>& events, double tol, std::size_t dimension)
+            : events_(events), tol_(tol), g_prev_(events.size()), g_next_(events.size()), y_work_(dimension) {}
+
+        void start(double x0, const std::vector<double>& y0) {
+            for (std::size_t i = 0; i < events_.size(); ++i) {
+                g_prev_[i] = events_[i].g(x0, y0);
+            }
+        }
+
+        // Sprawdza krok [x_prev, x_next]; interpolate(x, y) zapisuje stan wewnatrz kroku. Dopisuje zdarzenia do out
+        // (do pierwszego terminalnego wlacznie) i zwraca punkt zdarzenia terminalnego, jesli wystapilo.
+        template <typename Interpolate>
+        std::optional<double> check(double x_prev, double x_next, const std::vector<double>& y_next,
+                                    Interpolate&& interpolate, std::vector<EventRecord>& out) {
+            found_.clear();
+            for (std::size_t i = 0; i < events_.size(); ++i) {
+                g_next_[i] = events_[i].g(x_next, y_next);
+                if (!crosses(i)) {
+                    continue;
+                }
+                double x_event = x_next;
+                if (g_next_[i] != 0.0) {
+                    const EventFunction& g = events_[i].g;
+                    auto root = nonlinear::bisectionMethod([&](double x) {
+                        interpolate(x, y_work_);
+                        return g(x, y_work_);
+                    }, x_prev, x_next, tol_, 200);
+                    if (root) {
+                        x_event = *root;
+                    }
+                }
+                found_.push_back({ i, x_event });
+            }
+            std::swap(g_prev_, g_next_);
+            std::stable_sort(found_.begin(), found_.end(),
+                             [](const Crossing& a, const Crossing& b) { return a.x < b.x; });
+
+            for (const Crossing& c : found_) {
+                EventRecord record{ c.index, c.x, y_next };
+                if (c.x != x_next) {
+                    interpolate(c.x, record.y);
+                }
+                out.push_back(std::move(record));
+                if (events_[c.index].terminal) {
+                    return c.x;
+                }
+            }
+            return std::nullopt;
+        }
+
+    private:
+        struct Crossing {
+            std::size_t index;
+            double x;
+        };
+
+        bool crosses(std::size_t i) const {
+            const bool rising = g_prev_[i] < 0.0 && g_next_[i] >= 0.0;
+            const bool falling = g_prev_[i] > 0.0 && g_next_[i] <= 0.0;
+            switch (events_[i].direction) {
+                case EventDirection::Rising: return rising;
+                case EventDirection::Falling: return falling;
+                default: return rising || falling;
+            }
+        }
+
+        const std::vector<OdeEvent>& events_;
+        double tol_;
+        std::vector<double> g_prev_, g_next_, y_work_;
+        std::vector<Crossing> found_;
+    };
+} // Koniec anonimowej przestrzeni nazw
+
+EventSolution rungeKutta4Events(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h,
+                                double x_end, const std::vector<OdeEvent>& events, double event_tol) {
+    validateSystemInputs(f, y0, h, x0, x_end);
+    validateEvents(events, event_tol);
+
+    const std::size_t n = y0.size();
+    const std::size_t steps = stepCount(x0, h, x_end);
+    EventSolution result;
+    result.trajectory.dimension = n;
+    result.trajectory.x.reserve(steps + 1);
+    result.trajectory.y.reserve((steps + 1) * n);
+    result.trajectory.x.push_back(x0);
+    result.trajectory.y.insert(result.trajectory.y.end(), y0.begin(), y0.end());
+
+    EventMonitor monitor(events, event_tol, n);
+    monitor.start(x0, y0);
+    RungeKuttaWorkspace<Rk4Tableau> w(n);
+    std::vector<double> y = y0, y_prev(n), f_next(n), dense(5 * n);
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        const double x = x0 + static_cast<double>(step) * h;
+        const double x_next = x0 + static_cast<double>(step + 1) * h;
+        y_prev = y;
+        rungeKuttaStep<Rk4Tableau>(f, x, y, h, w);
+
+        // Interpolant budowany dopiero przy zmianie znaku; f(x, y_prev) to pierwszy etap RK4
+        bool have_interpolant = false;
+        auto interpolate = [&](double xq, std::vector<double>& out) {
+            if (!have_interpolant) {
+                f(x_next, y, f_next);
+                hermiteDenseStep(n, h, y_prev.data(), w.k[0].data(), y.data(), f_next.data(), dense.data());
+                have_interpolant = true;
+            }
+            evaluateDenseStep(dense.data(), n, (xq - x) / h, out.data());
+        };
+        auto terminal = monitor.check(x, x_next, y, interpolate, result.events);
+        if (terminal) {
+            const std::vector<double>& y_event = result.events.back().y;
+            result.trajectory.x.push_back(*terminal);
+            result.trajectory.y.insert(result.trajectory.y.end(), y_event.begin(), y_event.end());
+            result.terminated = true;
+            break;
+        }
+        result.trajectory.x.push_back(x_next);
+        result.trajectory.y.insert(result.trajectory.y.end(), y.begin(), y.end());
+    }
+    return result;
+}
+
+void DenseOutput::evaluate(double x, std::vector<double>& y) const {
+    if (empty()) {
+        throw std::invalid_argument("Brak danych rozwiazania ciaglego.");
+    }
+    if (x < x_.front() || x > x_.back()) {
+        throw std::invalid_argument("Punkt x lezy poza przedzialem rozwiazania.");
+    }
+    // Krok zawierajacy x: ostatnia granica <= x
+    std::size_t step = static_cast<std::size_t>(std::upper_bound(x_.begin(), x_.end(), x) - x_.begin());
+    step = std::min(std::max<std::size_t>(step, 1), x_.size() - 1) - 1;
+    double theta = (x - x_[step]) / (x_[step + 1] - x_[step]);
+    y.resize(dimension_);
+    evaluateDenseStep(coeffs_.data() + step * 5 * dimension_, dimension_, theta, y.data());
+}
+
+std::vector<double> DenseOutput::operator()(double x) const {
+    std::vector<double> y(dimension_);
+    evaluate(x, y);
+    return y;
+}
+
+namespace {
+    // Zagniezdzona para Rungego-Kutty z wlasnoscia FSAL (ostatni etap to f w nowym punkcie)
+    struct EmbeddedTableau {
+        int stages;
+        int error_order;      // Rzad metody nizszego rzedu + 1 (wykladnik w regulatorze kroku)
+        const double* c;
+        const double* a;      // Wiersze a[i][j] dla j < i, w tablicy stages x stages
+        const double* b;      // Wagi rozwiazania (rowne ostatniemu wierszowi a - FSAL)
+        const double* e;      // Roznica wag b - b* do oszacowania bledu
+        bool hairer_dense;    // Interpolant Hairera (Dormand-Prince) zamiast kubicznego Hermite'a
+    };
+
+    const double kDpC[7] = { 0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0 };
+    const double kDpA[7 * 7] = {
+        0, 0, 0, 0, 0, 0, 0,
+        1.0 / 5.0, 0, 0, 0, 0, 0, 0,
+        3.0 / 40.0, 9.0 / 40.0, 0, 0, 0, 0, 0,
+        44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0, 0, 0, 0,
+        19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0, 0, 0,
+        9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0, 0,
+        35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0,
+    };
+    const double kDpB[7] = { 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0 };
+    const double kDpE[7] = { 71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0, -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0 };
+    // Wspolczynniki interpolantu 4. rzedu (Hairer, Norsett, Wanner)
+    const double kDpD[7] = { -12715105075.0 / 11282082432.0, 0.0, 87487479700.0 / 32700410799.0,
+                             -10690763975.0 / 1880347072.0, 701980252875.0 / 199316789632.0,
+                             -1453857185.0 / 822651844.0, 69997945.0 / 29380423.0 };
+
+    const double kBsC[4] = { 0.0, 1.0 / 2.0, 3.0 / 4.0, 1.0 };
+    const double kBsA[4 * 4] = {
+        0, 0, 0, 0,
+        1.0 / 2.0, 0, 0, 0,
+        0.0, 3.0 / 4.0, 0, 0,
+        2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0,
+    };
+    const double kBsB[4] = { 2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0.0 };
+    const double kBsE[4] = { -5.0 / 72.0, 1.0 / 12.0, 1.0 / 9.0, -1.0 / 8.0 };
+
+    const EmbeddedTableau kDormandPrince = { 7, 5, kDpC, kDpA, kDpB, kDpE, true };
+    const EmbeddedTableau kBogackiShampine = { 4, 3, kBsC, kBsA, kBsB, kBsE, false };
+
+    double errorNorm(const std::vector<double>& err, const std::vector<double>& y, const std::vector<double>& y_new,
+                     const AdaptiveOptions& options) {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < err.size(); ++i) {
+            double scale = options.abs_tol + options.rel_tol * std::max(std::abs(y[i]), std::abs(y_new[i]));
+            double r = err[i] / scale;
+            sum += r * r;
+        }
+        return std::sqrt(sum / static_cast<double>(err.size()));
+    }
+
+    // Etapy 2..s pary zagniezdzonej (k[0] = f(x, y) musi byc juz policzone); ostatni etap liczony jest w x_last,
+    // zeby krok domykajacy przedzial trafial dokladnie w koniec. err otrzymuje nieskalowane oszacowanie bledu.
+    void embeddedStep(const EmbeddedTableau& tab, const OdeSystemFunction& f, double x, double h, double x_last,
+                      const std::vector<double>& y, std::vector<std::vector<double>>& k, std::vector<double>& y_new,
+                      std::vector<double>& tmp, std::vector<double>& err) {
+        const int s = tab.stages;
+        const std::size_t n = y.size();
+        for (int st = 1; st < s; ++st) {
+            const double* a = tab.a + st * s;
+            for (std::size_t i = 0; i < n; ++i) {
+                double acc = 0.0;
+                for (int j = 0; j < st; ++j) {
+                    acc += a[j] * k[j][i];
+                }
+                tmp[i] = y[i] + h * acc;
+            }
+            if (st == s - 1) {
+                y_new = tmp; // Ostatni wiersz a to wagi b
+            }
+            f(st == s - 1 ? x_last : x + tab.c[st] * h, tmp, k[st]);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            double acc = 0.0;
+            for (int j = 0; j < s; ++j) {
+                acc += tab.e[j] * k[j][i];
+            }
+            err[i] = h * acc;
+        }
+    }
+
+    // Poczatkowy krok wg heurystyki Hairera (wymaga jednego dodatkowego wywolania f)
+    double initialStep(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, const std::vector<double>& f0,
+                       int order, double max_step, const AdaptiveOptions& options, long long& evaluations) {
+        const std::size_t n = y0.size();
+        double d0 = 0.0, d1 = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            double scale = options.abs_tol + options.rel_tol * std::abs(y0[i]);
+            d0 += (y0[i] / scale) * (y0[i] / scale);
+            d1 += (f0[i] / scale) * (f0[i] / scale);
+        }
+        d0 = std::sqrt(d0 / n);
+        d1 = std::sqrt(d1 / n);
+        double h0 = (d0 < 1e-5 || d1 < 1e-5) ? 1e-6 : 0.01 * d0 / d1;
+        h0 = std::min(h0, max_step);
+
+        std::vector<double> y1(n), f1(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            y1[i] = y0[i] + h0 * f0[i];
+        }
+        f(x0 + h0, y1, f1);
+        ++evaluations;
+        double d2 = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            double scale = options.abs_tol + options.rel_tol * std::abs(y0[i]);
+            double r = (f1[i] - f0[i]) / scale;
+            d2 += r * r;
+        }
+        d2 = std::sqrt(d2 / n) / h0;
+        double dmax = std::max(d1, d2);
+        double h1 = (dmax <= 1e-15) ? std::max(1e-6, h0 * 1e-3) : std::pow(0.01 / dmax, 1.0 / order);
+        return std::min({ 100.0 * h0, h1, max_step });
+    }
+
+    void validateAdaptiveInputs(const OdeSystemFunction& f, const std::vector<double>& y0, double x0, double x_end,
+                                const AdaptiveOptions& options) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie jest zdefiniowana (jest pusta).");
+        }
+        if (y0.empty()) {
+            throw std::invalid_argument("Wektor stanu poczatkowego (y0) nie moze byc pusty.");
+        }
+        if (x_end < x0) {
+            throw std::invalid_argument("Punkt koncowy (x_end) nie moze byc mniejszy od punktu poczatkowego (x0).");
+        }
+        if (options.abs_tol <= 0 || options.rel_tol < 0 || options.max_steps <= 0) {
+            throw std::invalid_argument("Tolerancje i limit krokow musza byc dodatnie.");
+        }
+    }
+
+    std::optional<AdaptiveSolution> integrateAdaptive(const EmbeddedTableau& tab, const OdeSystemFunction& f, double x0,
+                                                      const std::vector<double>& y0, double x_end,
+                                                      const AdaptiveOptions& options, EventMonitor* monitor = nullptr) {
+        validateAdaptiveInputs(f, y0, x0, x_end, options);
+
+        const std::size_t n = y0.size();
+        const int s = tab.stages;
+        AdaptiveSolution result;
+        result.steps.dimension = n;
+        result.steps.x.push_back(x0);
+        result.steps.y.insert(result.steps.y.end(), y0.begin(), y0.end());
+        if (options.dense_output) {
+            result.dense.reset(n, x0);
+        }
+        if (x_end == x0) {
+            return result;
+        }
+
+        // Wszystkie bufory alokowane raz
+        std::vector<std::vector<double>> k(s, std::vector<double>(n));
+        std::vector<double> y = y0, y_new(n), tmp(n), err(n), dense(5 * n, 0.0);
+        double max_step = options.max_step > 0 ? options.max_step : (x_end - x0);
+
+        f(x0, y, k[0]);
+        result.rhs_evaluations = 1;
+        double h = options.initial_step > 0
+            ? std::min(options.initial_step, max_step)
+            : initialStep(f, x0, y, k[0], tab.error_order, max_step, options, result.rhs_evaluations);
+
+        // Parametry regulatora PI (Hairer, Wanner)
+        const double beta = 0.04;
+        const double expo = 1.0 / tab.error_order - 0.75 * beta;
+        const double safety = 0.9, fac_min = 0.2, fac_max = 10.0;
+        double err_old = 1e-4;
+        bool last_rejected = false;
+        double x = x0;
+
+        while (x < x_end) {
+            if (result.accepted_steps + result.rejected_steps >= options.max_steps) {
+                return std::nullopt;
+            }
+            if (h < 16.0 * std::numeric_limits<double>::epsilon() * std::max(1.0, std::abs(x))) {
+                return std::nullopt; // Krok zmalal ponizej precyzji arytmetyki
+            }
+            bool last = (x + h >= x_end);
+            if (last) {
+                h = x_end - x;
+            }
+
+            // Etapy 2..s (etap 1 to f w biezacym punkcie, dostepne dzieki FSAL)
+            embeddedStep(tab, f, x, h, last ? x_end : x + h, y, k, y_new, tmp, err);
+            result.rhs_evaluations += s - 1;
+            double error = errorNorm(err, y, y_new, options);
+
+            if (error <= 1.0) {
+                if (options.dense_output || monitor) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        double diff = y_new[i] - y[i];
+                        double bspl = h * k[0][i] - diff;
+                        dense[i] = y[i];
+                        dense[n + i] = diff;
+                        dense[2 * n + i] = bspl;
+                        dense[3 * n + i] = diff - h * k[s - 1][i] - bspl;
+                        if (tab.hairer_dense) {
+                            double acc = 0.0;
+                            for (int j = 0; j < s; ++j) {
+                                acc += kDpD[j] * k[j][i];
+                            }
+                            dense[4 * n + i] = h * acc;
+                        }
+                    }
+                }
+
+                const double x_new = last ? x_end : x + h;
+                if (monitor) {
+                    auto interpolate = [&](double xq, std::vector<double>& out) {
+                        evaluateDenseStep(dense.data(), n, (xq - x) / h, out.data());
+                    };
+                    auto terminal = monitor->check(x, x_new, y_new, interpolate, result.events);
+                    if (terminal) {
+                        // Krok skrocony do zdarzenia; jego interpolant to Hermite z pochodna w punkcie zdarzenia
+                        const std::vector<double>& y_event = result.events.back().y;
+                        if (options.dense_output) {
+                            f(*terminal, y_event, tmp);
+                            ++result.rhs_evaluations;
+                            hermiteDenseStep(n, *terminal - x, y.data(), k[0].data(), y_event.data(), tmp.data(),
+                                             dense.data());
+                            result.dense.appendStep(*terminal, dense.data());
+                        }
+                        result.steps.x.push_back(*terminal);
+                        result.steps.y.insert(result.steps.y.end(), y_event.begin(), y_event.end());
+                        ++result.accepted_steps;
+                        result.terminated = true;
+                        return result;
+                    }
+                }
+                x = x_new;
+                if (options.dense_output) {
+                    result.dense.appendStep(x, dense.data());
+                }
+                std::swap(y, y_new);
+                std::swap(k[0], k[s - 1]); // FSAL
+                result.steps.x.push_back(x);
+                result.steps.y.insert(result.steps.y.end(), y.begin(), y.end());
+                ++result.accepted_steps;
+
+                double fac = std::pow(std::max(error, 1e-10), expo) / std::pow(err_old, beta);
+                fac = std::clamp(fac / safety, 1.0 / fac_max, 1.0 / fac_min);
+                double h_new = h / fac;
+                if (last_rejected) {
+                    h_new = std::min(h_new, h);
+                }
+                err_old = std::max(error, 1e-4);
+                last_rejected = false;
+                h = std::min(h_new, max_step);
+            } else {
+                ++result.rejected_steps;
+                double fac = std::min(1.0 / fac_min, std::pow(error, expo) / safety);
+                h /= fac;
+                last_rejected = true;
+            }
+        }
+        return result;
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+std::optional<AdaptiveSolution> dormandPrince45(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                               double x_end, const AdaptiveOptions& options) {
+    return integrateAdaptive(kDormandPrince, f, x0, y0, x_end, options);
+}
+
+std::optional<AdaptiveSolution> bogackiShampine32(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                                 double x_end, const AdaptiveOptions& options) {
+    return integrateAdaptive(kBogackiShampine, f, x0, y0, x_end, options);
+}
+
+std::optional<AdaptiveSolution> dormandPrince45Events(const OdeSystemFunction& f, double x0,
+                                                     const std::vector<double>& y0, double x_end,
+                                                     const std::vector<OdeEvent>& events,
+                                                     const AdaptiveOptions& options, double event_tol) {
+    validateAdaptiveInputs(f, y0, x0, x_end, options);
+    validateEvents(events, event_tol);
+    EventMonitor monitor(events, event_tol, y0.size());
+    monitor.start(x0, y0);
+    return integrateAdaptive(kDormandPrince, f, x0, y0, x_end, options, &monitor);
+}
+
+// === Metody wielokrokowe Adamsa-Bashfortha-Moultona ===
+
+namespace {
+    // Wspolczynniki dla rzedow 2..5 (wiersz order - 2). Predyktor: y_{n+1} = y_n + h * sum_j AB[j] * f_{n-j},
+    // korektor: y_{n+1} = y_n + h * (AM[0] * f_{n+1} + sum_j AM[j + 1] * f_{n-j}).
+    const double kAdamsBashforth[4][5] = {
+        { 3.0 / 2.0, -1.0 / 2.0 },
+        { 23.0 / 12.0, -16.0 / 12.0, 5.0 / 12.0 },
+        { 55.0 / 24.0, -59.0 / 24.0, 37.0 / 24.0, -9.0 / 24.0 },
+        { 1901.0 / 720.0, -2774.0 / 720.0, 2616.0 / 720.0, -1274.0 / 720.0, 251.0 / 720.0 },
+    };
+    const double kAdamsMoulton[4][5] = {
+        { 1.0 / 2.0, 1.0 / 2.0 },
+        { 5.0 / 12.0, 8.0 / 12.0, -1.0 / 12.0 },
+        { 9.0 / 24.0, 19.0 / 24.0, -5.0 / 24.0, 1.0 / 24.0 },
+        { 251.0 / 720.0, 646.0 / 720.0, -264.0 / 720.0, 106.0 / 720.0, -19.0 / 720.0 },
+    };
+    // Oszacowanie Milne'a: blad korektora ~ C_AM / (C_AB - C_AM) * (y_korektor - y_predyktor)
+    const double kMilneFactor[4] = { 1.0 / 6.0, 1.0 / 10.0, 19.0 / 270.0, 27.0 / 502.0 };
+
+    void validateAdamsOrder(int order) {
+        if (order < 2 || order > 5) {
+            throw std::invalid_argument("Rzad metody Adamsa musi nalezec do przedzialu [2, 5].");
+        }
+    }
+
+    // Predyktor, ewaluacja i korektor (PEC); koncowa ewaluacja f(x + h, y_new) nalezy do wywolujacego.
+    // fs[j] to f_{n-j}; wykorzystywane jest order pierwszych wpisow.
+    void adamsPecStep(const OdeSystemFunction& f, double x, double h, int order, const std::vector<double>& y,
+                      const std::vector<std::vector<double>>& fs, std::vector<double>& y_pred,
+                      std::vector<double>& f_pred, std::vector<double>& y_new) {
+        const double* ab = kAdamsBashforth[order - 2];
+        const double* am = kAdamsMoulton[order - 2];
+        const std::size_t n = y.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            double acc = 0.0;
+            for (int j = 0; j < order; ++j) {
+                acc += ab[j] * fs[j][i];
+            }
+            y_pred[i] = y[i] + h * acc;
+        }
+        f(x + h, y_pred, f_pred);
+        for (std::size_t i = 0; i < n; ++i) {
+            double acc = am[0] * f_pred[i];
+            for (int j = 0; j < order - 1; ++j) {
+                acc += am[j + 1] * fs[j][i];
+            }
+            y_new[i] = y[i] + h * acc;
+        }
+    }
+
+    // Przesuwa historie pochodnych: najstarszy bufor staje sie fs[0] i jest nadpisywany przez f(x_new, y_new)
+    void pushDerivative(const OdeSystemFunction& f, double x_new, const std::vector<double>& y_new,
+                        std::vector<std::vector<double>>& fs) {
+        std::rotate(fs.rbegin(), fs.rbegin() + 1, fs.rend());
+        f(x_new, y_new, fs[0]);
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+void adamsBashforthMoulton(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h, double x_end,
+                           int order, const SystemObserver& observer) {
+    validateSystemInputs(f, y0, h, x0, x_end);
+    validateAdamsOrder(order);
+    validateObserver(static_cast<bool>(observer));
+
+    const std::size_t n = y0.size();
+    const std::size_t steps = stepCount(x0, h, x_end);
+    std::vector<std::vector<double>> fs(order, std::vector<double>(n));
+    std::vector<double> y = y0, y_pred(n), f_pred(n), y_new(n);
+    RungeKuttaWorkspace<Rk4Tableau> w(n);
+    f(x0, y, fs[0]);
+
+    for (std::size_t i = 0; i <= steps; ++i) {
+        const double x = x0 + static_cast<double>(i) * h;
+        observer(x, y);
+        if (i == steps) {
+            break;
+        }
+        if (i + 1 < static_cast<std::size_t>(order)) {
+            // Start: brakujace punkty historii z RK4
+            rungeKuttaStep<Rk4Tableau>(f, x, y, h, w);
+        } else {
+            adamsPecStep(f, x, h, order, y, fs, y_pred, f_pred, y_new);
+            std::swap(y, y_new);
+        }
+        pushDerivative(f, x0 + static_cast<double>(i + 1) * h, y, fs);
+    }
+}
+
+SystemSolution adamsBashforthMoulton(const OdeSystemFunction& f, double x0, const std::vector<double>& y0, double h,
+                                     double x_end, int order) {
+    validateSystemInputs(f, y0, h, x0, x_end);
+    SystemSolution solution;
+    solution.dimension = y0.size();
+    const std::size_t points = stepCount(x0, h, x_end) + 1;
+    solution.x.reserve(points);
+    solution.y.reserve(points * y0.size());
+    adamsBashforthMoulton(f, x0, y0, h, x_end, order, [&solution](double x, const std::vector<double>& y) {
+        solution.x.push_back(x);
+        solution.y.insert(solution.y.end(), y.begin(), y.end());
+    });
+    return solution;
+}
+
+std::optional<AdaptiveSolution> adamsBashforthMoultonAdaptive(const OdeSystemFunction& f, double x0,
+                                                             const std::vector<double>& y0, double x_end, int order,
+                                                             const AdaptiveOptions& options) {
+    validateAdaptiveInputs(f, y0, x0, x_end, options);
+    validateAdamsOrder(order);
+
+    const std::size_t n = y0.size();
+    AdaptiveSolution result;
+    result.steps.dimension = n;
+    result.steps.x.push_back(x0);
+    result.steps.y.insert(result.steps.y.end(), y0.begin(), y0.end());
+    if (options.dense_output) {
+        result.dense.reset(n, x0);
+    }
+    if (x_end == x0) {
+        return result;
+    }
+
+    std::vector<std::vector<double>> fs(order, std::vector<double>(n));
+    std::vector<std::vector<double>> k(kDormandPrince.stages, std::vector<double>(n));
+    std::vector<double> y = y0, y_pred(n), f_pred(n), y_new(n), tmp(n), err(n), dense(5 * n, 0.0);
+    const double max_step = options.max_step > 0 ? options.max_step : (x_end - x0);
+
+    f(x0, y, fs[0]);
+    result.rhs_evaluations = 1;
+    double h = options.initial_step > 0
+        ? std::min(options.initial_step, max_step)
+        : initialStep(f, x0, y, fs[0], order + 1, max_step, options, result.rhs_evaluations);
+
+    // history - liczba kolejnych punktow o stalym kroku h (w tym biezacy); ponizej order krok wykonuje
+    // para Dormanda-Prince'a 5(4), wiec kroki startowe tez podlegaja kontroli bledu
+    int history = 1;
+    const double safety = 0.9;
     double x = x0;
-    double y = y0;
 
-    while (x <= x_end) {
-        results.push_back({x, y});
-        double k1 = h * f(x, y);
-        double k2 = h * f(x + h / 2.0, y + k1 / 2.0);
-        double k3 = h * f(x + h / 2.0, y + k2 / 2.0);
-        double k4 = h * f(x + h, y + k3);
-        y = y + (1.0 / 6.0) * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
-        x = x + h;
+    while (x < x_end) {
+        if (result.accepted_steps + result.rejected_steps >= options.max_steps) {
+            return std::nullopt;
+        }
+        if (h < 16.0 * std::numeric_limits<double>::epsilon() * std::max(1.0, std::abs(x))) {
+            return std::nullopt;
+        }
+        bool last = (x + h >= x_end);
+        if (last && h != x_end - x) {
+            h = x_end - x;
+            history = 1; // Zmiana kroku uniewaznia historie
+        }
+
+        const bool multistep = (history >= order);
+        if (multistep) {
+            adamsPecStep(f, x, h, order, y, fs, y_pred, f_pred, y_new);
+            ++result.rhs_evaluations;
+            for (std::size_t i = 0; i < n; ++i) {
+                err[i] = kMilneFactor[order - 2] * (y_new[i] - y_pred[i]);
+            }
+        } else {
+            k[0] = fs[0];
+            embeddedStep(kDormandPrince, f, x, h, last ? x_end : x + h, y, k, y_new, tmp, err);
+            result.rhs_evaluations += kDormandPrince.stages - 1;
+        }
+        const double error = errorNorm(err, y, y_new, options);
+        const double error_order = multistep ? order + 1 : kDormandPrince.error_order;
+
+        if (error > 1.0) {
+            ++result.rejected_steps;
+            h *= std::max(0.2, safety * std::pow(error, -1.0 / error_order));
+            history = 1;
+            continue;
+        }
+
+        const double x_new = last ? x_end : x + h;
+        if (multistep) {
+            pushDerivative(f, x_new, y_new, fs);
+            ++result.rhs_evaluations;
+        } else {
+            std::rotate(fs.rbegin(), fs.rbegin() + 1, fs.rend());
+            fs[0] = k[kDormandPrince.stages - 1]; // FSAL: ostatni etap to f(x_new, y_new)
+        }
+        if (options.dense_output) {
+            hermiteDenseStep(n, h, y.data(), fs[1].data(), y_new.data(), fs[0].data(), dense.data());
+            result.dense.appendStep(x_new, dense.data());
+        }
+        std::swap(y, y_new);
+        x = x_new;
+        result.steps.x.push_back(x);
+        result.steps.y.insert(result.steps.y.end(), y.begin(), y.end());
+        ++result.accepted_steps;
+        history = std::min(history + 1, order);
+
+        // Powiekszenie kroku wymaga ponownego startu, wiec krok jest podwajany tylko przy duzym zapasie dokladnosci
+        // oszacowanym przez korektor (zerowy blad, np. dla stalego f, tez pozwala powiekszyc krok)
+        if (multistep && history == order && safety * std::pow(std::max(error, 1e-10), -1.0 / (order + 1)) >= 2.0 &&
+            2.0 * h <= max_step) {
+            h *= 2.0;
+            history = 1;
+        }
+    }
+    return result;
+}
+
+// === Parareal ===
+
+namespace {
+    void validatePropagatorInputs(const OdeSystemFunction& f, int steps) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie jest zdefiniowana (jest pusta).");
+        }
+        if (steps <= 0) {
+            throw std::invalid_argument("Liczba krokow propagatora musi byc dodatnia.");
+        }
+    }
+
+    template <typename Tableau>
+    Propagator fixedStepPropagator(const OdeSystemFunction& f, int steps) {
+        validatePropagatorInputs(f, steps);
+        return [f, steps](double x_from, double x_to, std::vector<double>& y) {
+            // Bufory lokalne dla wywolania - propagator moze dzialac na wielu watkach naraz
+            RungeKuttaWorkspace<Tableau> w(y.size());
+            const double h = (x_to - x_from) / steps;
+            for (int i = 0; i < steps; ++i) {
+                rungeKuttaStep<Tableau>(f, x_from + i * h, y, h, w);
+            }
+        };
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+Propagator eulerPropagator(const OdeSystemFunction& f, int steps) {
+    return fixedStepPropagator<EulerTableau>(f, steps);
+}
+
+Propagator rungeKutta4Propagator(const OdeSystemFunction& f, int steps) {
+    return fixedStepPropagator<Rk4Tableau>(f, steps);
+}
+
+Propagator dormandPrince45Propagator(const OdeSystemFunction& f, const AdaptiveOptions& options) {
+    validatePropagatorInputs(f, 1);
+    AdaptiveOptions local = options;
+    local.dense_output = false;
+    return [f, local](double x_from, double x_to, std::vector<double>& y) {
+        auto solution = dormandPrince45(f, x_from, y, x_to, local);
+        if (!solution) {
+            throw std::runtime_error("Metoda Dormanda-Prince'a nie osiagnela konca przedzialu.");
+        }
+        const double* last = solution->steps.state(solution->steps.size() - 1);
+        std::copy(last, last + y.size(), y.begin());
+    };
+}
+
+PararealResult parareal(const Propagator& coarse, const Propagator& fine, double x0, const std::vector<double>& y0,
+                        double x_end, const PararealOptions& options) {
+    if (!coarse || !fine) {
+        throw std::invalid_argument("Propagatory coarse i fine musza byc zdefiniowane.");
+    }
+    if (y0.empty()) {
+        throw std::invalid_argument("Wektor stanu poczatkowego (y0) nie moze byc pusty.");
+    }
+    if (x_end <= x0) {
+        throw std::invalid_argument("Punkt koncowy (x_end) musi byc wiekszy od punktu poczatkowego (x0).");
+    }
+    if (options.slices <= 0 || options.threads <= 0 || options.tol < 0) {
+        throw std::invalid_argument("Nieprawidlowe ustawienia algorytmu Parareal.");
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    const std::size_t slices = static_cast<std::size_t>(options.slices);
+    const std::size_t n = y0.size();
+    const int max_iterations = options.max_iterations > 0 ? std::min(options.max_iterations, options.slices)
+                                                          : options.slices;
+    auto boundary = [&](std::size_t i) {
+        return i == slices ? x_end : x0 + (x_end - x0) * static_cast<double>(i) / static_cast<double>(slices);
+    };
+
+    // u[i] - stan na granicy i; coarse_prev[i] / fine_prev[i] - wynik G i F z przedzialu i - 1
+    std::vector<std::vector<double>> u(slices + 1, y0), coarse_prev(slices + 1), fine_prev(slices + 1, y0);
+    std::vector<double> slice_seconds(slices, 0.0);
+    for (std::size_t i = 0; i < slices; ++i) {
+        coarse_prev[i + 1] = u[i];
+        coarse(boundary(i), boundary(i + 1), coarse_prev[i + 1]);
+        u[i + 1] = coarse_prev[i + 1];
+    }
+
+    PararealResult result;
+    std::vector<double> g(n);
+    for (int k = 1; k <= max_iterations; ++k) {
+        // Przedzialy 0..k-2 sa dokladne od poprzednich iteracji
+        const std::size_t first = static_cast<std::size_t>(k - 1);
+        parallel::parallelFor(slices - first, options.threads, [&](std::size_t item, std::size_t) {
+            const std::size_t i = first + item;
+            const auto slice_start = Clock::now();
+            fine_prev[i + 1] = u[i];
+            fine(boundary(i), boundary(i + 1), fine_prev[i + 1]);
+            if (k == 1) {
+                slice_seconds[i] = std::chrono::duration<double>(Clock::now() - slice_start).count();
+            }
+        });
+
+        // Korekta sekwencyjna; przedzial first ma juz dokladny stan poczatkowy, wiec u[first + 1] = F(u[first])
+        double change = 0.0;
+        for (std::size_t j = 0; j < n; ++j) {
+            const double updated = fine_prev[first + 1][j];
+            change = std::max(change, std::abs(updated - u[first + 1][j]) / (1.0 + std::abs(updated)));
+        }
+        u[first + 1] = fine_prev[first + 1];
+        for (std::size_t i = first + 1; i < slices; ++i) {
+            g = u[i];
+            coarse(boundary(i), boundary(i + 1), g);
+            for (std::size_t j = 0; j < n; ++j) {
+                double updated = g[j] + fine_prev[i + 1][j] - coarse_prev[i + 1][j];
+                change = std::max(change, std::abs(updated - u[i + 1][j]) / (1.0 + std::abs(updated)));
+                u[i + 1][j] = updated;
+            }
+            std::swap(coarse_prev[i + 1], g);
+        }
+        result.iterations = k;
+        if (change <= options.tol || first + 1 == slices) {
+            result.converged = true;
+            break;
+        }
+    }
+
+    result.boundaries.dimension = n;
+    result.boundaries.x.reserve(slices + 1);
+    result.boundaries.y.reserve((slices + 1) * n);
+    for (std::size_t i = 0; i <= slices; ++i) {
+        result.boundaries.x.push_back(boundary(i));
+        result.boundaries.y.insert(result.boundaries.y.end(), u[i].begin(), u[i].end());
     }
+    for (double seconds : slice_seconds) {
+        result.serial_fine_seconds += seconds;
+    }
+    result.elapsed_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    result.speedup = result.elapsed_seconds > 0.0 ? result.serial_fine_seconds / result.elapsed_seconds : 0.0;
+    return result;
+}
+
+// === Zespoly trajektorii ===
+
+namespace {
+    // Liczba czlonkow calkowanych razem: stan bloku i etapy RK4 mieszcza sie w pamieci podrecznej
+    constexpr std::size_t kEnsembleBlock = 256;
+
+    // Etapy RK4 dla bloku zespolu (dimension * kEnsembleBlock wartosci), alokowane raz na watek
+    struct Rk4Workspace {
+        explicit Rk4Workspace(std::size_t n) : k1(n), k2(n), k3(n), k4(n), tmp(n) {}
+        std::vector<double> k1, k2, k3, k4, tmp;
+    };
+
+    void validateEnsembleInputs(const EnsembleFunction& f, const EnsembleState& initial, double h,
+                                double x0, double x_end, int threads) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie jest zdefiniowana (jest pusta).");
+        }
+        if (initial.dimension == 0 || initial.members == 0 ||
+            initial.y.size() != initial.dimension * initial.members) {
+            throw std::invalid_argument("Stan zespolu musi miec rozmiar dimension * members > 0.");
+        }
+        if (h <= 0) {
+            throw std::invalid_argument("Krok calkowania (h) musi byc dodatni.");
+        }
+        if (x_end < x0) {
+            throw std::invalid_argument("Punkt koncowy (x_end) nie moze byc mniejszy od punktu poczatkowego (x0).");
+        }
+        if (threads <= 0) {
+            throw std::invalid_argument("Liczba watkow musi byc dodatnia.");
+        }
+    }
+
+    // Calkuje blok [first, first + count) od x0 przez steps krokow; bufory w ukladzie SoA o kroku count
+    void integrateEnsembleBlock(const EnsembleFunction& f, double x0, double h, std::size_t steps,
+                                const EnsembleState& initial, EnsembleState& result, std::size_t first,
+                                std::size_t count, Rk4Workspace& w, std::vector<double>& y,
+                                const EnsembleObserver* observer) {
+        const std::size_t dim = initial.dimension;
+        const std::size_t n = dim * count;
+        for (std::size_t k = 0; k < dim; ++k) {
+            std::copy_n(initial.y.data() + k * initial.members + first, count, y.data() + k * count);
+        }
+        if (observer) {
+            (*observer)(x0, y.data(), first, count);
+        }
+        for (std::size_t step = 0; step < steps; ++step) {
+            const double x = x0 + static_cast<double>(step) * h;
+            f(x, y.data(), w.k1.data(), count);
+            for (std::size_t i = 0; i < n; ++i) w.tmp[i] = y[i] + (h / 2.0) * w.k1[i];
+            f(x + h / 2.0, w.tmp.data(), w.k2.data(), count);
+            for (std::size_t i = 0; i < n; ++i) w.tmp[i] = y[i] + (h / 2.0) * w.k2[i];
+            f(x + h / 2.0, w.tmp.data(), w.k3.data(), count);
+            for (std::size_t i = 0; i < n; ++i) w.tmp[i] = y[i] + h * w.k3[i];
+            f(x + h, w.tmp.data(), w.k4.data(), count);
+            for (std::size_t i = 0; i < n; ++i) {
+                y[i] += (h / 6.0) * (w.k1[i] + 2.0 * w.k2[i] + 2.0 * w.k3[i] + w.k4[i]);
+            }
+            if (observer) {
+                (*observer)(x0 + static_cast<double>(step + 1) * h, y.data(), first, count);
+            }
+        }
+        for (std::size_t k = 0; k < dim; ++k) {
+            std::copy_n(y.data() + k * count, count, result.y.data() + k * result.members + first);
+        }
+    }
+
+    EnsembleState integrateEnsemble(const EnsembleFunction& f, double x0, const EnsembleState& initial,
+                                    double h, double x_end, int threads, const EnsembleObserver* observer) {
+        validateEnsembleInputs(f, initial, h, x0, x_end, threads);
+        const std::size_t steps = stepCount(x0, h, x_end);
+        const std::size_t blocks = (initial.members + kEnsembleBlock - 1) / kEnsembleBlock;
+        EnsembleState result(initial.dimension, initial.members);
+
+        // Bufory bloku przydzielane raz na watek
+        const std::size_t workers = std::min<std::size_t>(static_cast<std::size_t>(threads), blocks);
+        std::vector<Rk4Workspace> workspaces(workers, Rk4Workspace(initial.dimension * kEnsembleBlock));
+        std::vector<std::vector<double>> states(workers, std::vector<double>(initial.dimension * kEnsembleBlock));
+        parallel::parallelFor(blocks, threads, [&](std::size_t b, std::size_t worker) {
+            const std::size_t first = b * kEnsembleBlock;
+            const std::size_t count = std::min(kEnsembleBlock, initial.members - first);
+            integrateEnsembleBlock(f, x0, h, steps, initial, result, first, count, workspaces[worker], states[worker],
+                                   observer);
+        });
+        return result;
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+EnsembleState rungeKutta4Ensemble(const EnsembleFunction& f, double x0, const EnsembleState& initial,
+                                  double h, double x_end, int threads) {
+    return integrateEnsemble(f, x0, initial, h, x_end, threads, nullptr);
+}
 
-    return results;
+EnsembleState rungeKutta4Ensemble(const EnsembleFunction& f, double x0, const EnsembleState& initial,
+                                  double h, double x_end, int threads, const EnsembleObserver& observer) {
+    validateObserver(static_cast<bool>(observer));
+    return integrateEnsemble(f, x0, initial, h, x_end, threads, &observer);
 }
 
 } // namespace ode
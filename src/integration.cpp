@@ -2,6 +2,15 @@
 
 #include "integration.h"
 #include <cmath>
+#include <vector>
+#include <algorithm>
+#include <istream>
+#include <sstream>
+#include <string>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <limits>
 #include <stdexcept> // Upewnij sie, ze jest dolaczony
 
 namespace numeric {
@@ -27,6 +36,55 @@ void validateGaussInputs(const std::function<double(double)>& f, int nodes) {
     }
 }
 
+namespace {
+    // Tablice wezlow i wag Gaussa-Legendre'a na przedziale [-1, 1]
+    void gaussTable(int nodes, const double*& x_nodes, const double*& w_weights) {
+        static const double x2[] = { -0.5773502691896257, 0.5773502691896257 };
+        static const double w2[] = { 1.0, 1.0 };
+        static const double x3[] = { -0.7745966692414834, 0.0, 0.7745966692414834 };
+        static const double w3[] = { 0.5555555555555556, 0.8888888888888888, 0.5555555555555556 };
+        static const double x4[] = { -0.8611363115940526, -0.3399810435848563, 0.3399810435848563, 0.8611363115940526 };
+        static const double w4[] = { 0.3478548451374538, 0.6521451548625461, 0.6521451548625461, 0.3478548451374538 };
+        switch (nodes) {
+            case 2: x_nodes = x2; w_weights = w2; break;
+            case 3: x_nodes = x3; w_weights = w3; break;
+            case 4: x_nodes = x4; w_weights = w4; break;
+            default: throw std::invalid_argument("Nieobslugiwana liczba wezlow. Wybierz 2, 3 lub 4.");
+        }
+    }
+
+    void validateBatchInputs(const BatchFunction& f, int n, int block_size) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie moze byc pusta.");
+        }
+        if (n <= 0) {
+            throw std::invalid_argument("Liczba podprzedzialow (n) musi byc dodatnia.");
+        }
+        if (block_size <= 0) {
+            throw std::invalid_argument("Rozmiar bloku musi byc dodatni.");
+        }
+    }
+
+    // Sumuje weight(i) * f(node(i)) dla i < count, wywolujac f porcjami po block_size punktow
+    template <typename NodeFn, typename WeightFn>
+    double blockedWeightedSum(const BatchFunction& f, long long count, int block_size, NodeFn node, WeightFn weight) {
+        std::vector<double> xs(static_cast<std::size_t>(block_size));
+        std::vector<double> fx(static_cast<std::size_t>(block_size));
+        double sum = 0.0;
+        for (long long start = 0; start < count; start += block_size) {
+            std::size_t len = static_cast<std::size_t>(std::min<long long>(block_size, count - start));
+            for (std::size_t j = 0; j < len; ++j) {
+                xs[j] = node(start + static_cast<long long>(j));
+            }
+            f(xs.data(), fx.data(), len);
+            for (std::size_t j = 0; j < len; ++j) {
+                sum += weight(start + static_cast<long long>(j)) * fx[j];
+            }
+        }
+        return sum;
+    }
+} // Koniec anonimowej przestrzeni nazw
+
 double rectangleRule(const std::function<double(double)>& f, double a, double b, int n) {
     validateBasicInputs(f, n);
     double h = (b - a) / static_cast<double>(n);
@@ -66,20 +124,9 @@ double simpsonRule(const std::function<double(double)>& f, double a, double b, i
 
 double gaussLegendre(const std::function<double(double)>& f, double a, double b, int nodes) {
     validateGaussInputs(f, nodes);
-    static const double x2[] = { -0.5773502691896257, 0.5773502691896257 };
-    static const double w2[] = { 1.0, 1.0 };
-    static const double x3[] = { -0.7745966692414834, 0.0, 0.7745966692414834 };
-    static const double w3[] = { 0.5555555555555556, 0.8888888888888888, 0.5555555555555556 };
-    static const double x4[] = { -0.8611363115940526, -0.3399810435848563, 0.3399810435848563, 0.8611363115940526 };
-    static const double w4[] = { 0.3478548451374538, 0.6521451548625461, 0.6521451548625461, 0.3478548451374538 };
-
     const double* x_nodes;
     const double* w_weights;
-    switch (nodes) {
-        case 2: x_nodes = x2; w_weights = w2; break;
-        case 3: x_nodes = x3; w_weights = w3; break;
-        case 4: x_nodes = x4; w_weights = w4; break;
-    }
+    gaussTable(nodes, x_nodes, w_weights);
    
     double sum = 0.0;
     double c1 = (b - a) / 2.0;
@@ -108,5 +155,661 @@ double segmentedGaussLegendre(const std::function<double(double)>& f, double a,
     return total;
 }
 
+double rectangleRuleBatch(const BatchFunction& f, double a, double b, int n, int block_size) {
+    validateBatchInputs(f, n, block_size);
+    double h = (b - a) / static_cast<double>(n);
+    double sum = blockedWeightedSum(f, n, block_size,
+        [a, h](long long i) { return a + h * (static_cast<double>(i) + 0.5); },
+        [](long long) { return 1.0; });
+    return sum * h;
+}
+
+double trapezoidalRuleBatch(const BatchFunction& f, double a, double b, int n, int block_size) {
+    validateBatchInputs(f, n, block_size);
+    double h = (b - a) / static_cast<double>(n);
+    double sum = blockedWeightedSum(f, static_cast<long long>(n) + 1, block_size,
+        [a, b, h, n](long long i) { return i == n ? b : a + static_cast<double>(i) * h; },
+        [n](long long i) { return (i == 0 || i == n) ? 0.5 : 1.0; });
+    return sum * h;
+}
+
+double simpsonRuleBatch(const BatchFunction& f, double a, double b, int n, int block_size) {
+    validateBatchInputs(f, n, block_size);
+    if (n % 2 != 0) {
+        n++;
+    }
+    double h = (b - a) / static_cast<double>(n);
+    double sum = blockedWeightedSum(f, static_cast<long long>(n) + 1, block_size,
+        [a, b, h, n](long long i) { return i == n ? b : a + static_cast<double>(i) * h; },
+        [n](long long i) { return (i == 0 || i == n) ? 1.0 : (i % 2 != 0 ? 4.0 : 2.0); });
+    return sum * h / 3.0;
+}
+
+double segmentedGaussLegendreBatch(const BatchFunction& f, double a, double b, int nodes, int segments,
+                                   int block_size) {
+    validateBatchInputs(f, segments, block_size);
+    const double* x_nodes;
+    const double* w_weights;
+    gaussTable(nodes, x_nodes, w_weights);
+
+    double h = (b - a) / static_cast<double>(segments);
+    double c1 = h / 2.0;
+    // Punkt i odpowiada wezlowi (i % nodes) w segmencie (i / nodes)
+    double sum = blockedWeightedSum(f, static_cast<long long>(segments) * nodes, block_size,
+        [a, h, c1, nodes, x_nodes](long long i) {
+            double seg_a = a + static_cast<double>(i / nodes) * h;
+            return c1 * x_nodes[i % nodes] + seg_a + c1;
+        },
+        [nodes, w_weights](long long i) { return w_weights[i % nodes]; });
+    return c1 * sum;
+}
+
+std::optional<IntegrationResult> rombergIntegration(const std::function<double(double)>& f, double a, double b,
+                                                    double tolerance, int max_levels) {
+    if (!f) {
+        throw std::invalid_argument("Funkcja f nie moze byc pusta.");
+    }
+    if (tolerance <= 0) {
+        throw std::invalid_argument("Tolerancja musi byc dodatnia.");
+    }
+    if (max_levels <= 0 || max_levels > 30) {
+        throw std::invalid_argument("Liczba poziomow musi nalezec do przedzialu [1, 30].");
+    }
+
+    // Trzymamy tylko dwa wiersze tablicy Romberga - poprzedni i biezacy
+    std::vector<double> prev(max_levels + 1), curr(max_levels + 1);
+    double h = b - a;
+    prev[0] = 0.5 * h * (f(a) + f(b));
+    int evaluations = 2;
+
+    for (int k = 1; k <= max_levels; ++k) {
+        // Nowe punkty to srodki przedzialow z poprzedniego poziomu
+        h /= 2.0;
+        long long new_points = 1LL << (k - 1);
+        double sum = 0.0;
+        for (long long i = 0; i < new_points; ++i) {
+            sum += f(a + static_cast<double>(2 * i + 1) * h);
+        }
+        evaluations += static_cast<int>(new_points);
+        curr[0] = 0.5 * prev[0] + h * sum;
+
+        // Ekstrapolacja Richardsona
+        double factor = 1.0;
+        for (int j = 1; j <= k; ++j) {
+            factor *= 4.0;
+            curr[j] = curr[j - 1] + (curr[j - 1] - prev[j - 1]) / (factor - 1.0);
+        }
+
+        double error = std::abs(curr[k] - prev[k - 1]);
+        // Wymagamy co najmniej dwoch poziomow, aby uniknac przypadkowej zbieznosci
+        if (k >= 2 && error < tolerance) {
+            return IntegrationResult{ curr[k], error, evaluations };
+        }
+        std::swap(prev, curr);
+    }
+
+    return std::nullopt;
+}
+
+namespace {
+    // Rodzaje transformacji podwojnie wykladniczych
+    enum class DeKind { TanhSinh, ExpSinh, SinhSinh };
+
+    // Wezel w postaci znormalizowanej:
+    //  - TanhSinh: x to odleglosc od konca przedzialu [-1, 1] (1 - tanh(u)), wezel lustrzany przy drugim koncu,
+    //  - ExpSinh:  x to przesuniecie od a (exp(u)), bez odbicia,
+    //  - SinhSinh: x = sinh(u), wezel lustrzany -x.
+    struct DeNode {
+        double x;
+        double w;
+        bool mirrored;
+    };
+
+    const double kHalfPi = 1.57079632679489661923;
+    const double kDeTMax = 4.5;
+
+    DeNode makeDeNode(DeKind kind, double t) {
+        double u = kHalfPi * std::sinh(t);
+        double dudt = kHalfPi * std::cosh(t);
+        switch (kind) {
+            case DeKind::TanhSinh: {
+                // Dla t >= 0: 1 - tanh(u) = 2 e^{-2u} / (1 + e^{-2u}) bez utraty cyfr przy koncu przedzialu
+                double e = std::exp(-2.0 * u);
+                return { 2.0 * e / (1.0 + e), dudt * 4.0 * e / ((1.0 + e) * (1.0 + e)), t > 0.0 };
+            }
+            case DeKind::ExpSinh: {
+                double e = std::exp(u);
+                return { e, dudt * e, false };
+            }
+            case DeKind::SinhSinh:
+            default:
+                return { std::sinh(u), dudt * std::cosh(u), t > 0.0 };
+        }
+    }
+
+    // Nowe wezly poziomu `level` (krok 2^-level); tablice sa liczone raz i wspoldzielone miedzy wywolaniami
+    const std::vector<DeNode>& deLevelNodes(DeKind kind, int level) {
+        static std::map<std::pair<int, int>, std::vector<DeNode>> cache;
+        static std::mutex cache_mutex;
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto key = std::make_pair(static_cast<int>(kind), level);
+        auto it = cache.find(key);
+        if (it != cache.end()) {
+            return it->second;
+        }
+
+        std::vector<DeNode> nodes;
+        double h = std::ldexp(1.0, -level);
+        // Na poziomie 0 wszystkie t = k, na kolejnych tylko nieparzyste wielokrotnosci h
+        int step = (level == 0) ? 1 : 2;
+        int first = (level == 0) ? 0 : 1;
+        bool symmetric = (kind != DeKind::ExpSinh);
+        int k_max = static_cast<int>(kDeTMax / h);
+        int k_min = symmetric ? first : -k_max;
+        if (!symmetric && level > 0 && k_min % 2 == 0) {
+            ++k_min;
+        }
+        for (int k = k_min; k <= k_max; k += step) {
+            nodes.push_back(makeDeNode(kind, k * h));
+        }
+        return cache.emplace(key, std::move(nodes)).first->second;
+    }
+
+    // Wspolna petla poziomow: map_node zwraca sume w * f po wezle (z odbiciem) w zmiennych oryginalnych
+    template <typename MapNode>
+    std::optional<IntegrationResult> deIntegrate(DeKind kind, double scale, double tolerance, int max_levels,
+                                                 MapNode map_node) {
+        int evaluations = 0;
+        double sum = 0.0;
+        for (const DeNode& node : deLevelNodes(kind, 0)) {
+            sum += map_node(node, evaluations);
+        }
+        double previous = scale * sum;
+
+        for (int level = 1; level <= max_levels; ++level) {
+            for (const DeNode& node : deLevelNodes(kind, level)) {
+                sum += map_node(node, evaluations);
+            }
+            double current = scale * std::ldexp(sum, -level);
+            double error = std::abs(current - previous);
+            if (level >= 2 && error < tolerance) {
+                return IntegrationResult{ current, error, evaluations };
+            }
+            previous = current;
+        }
+        return std::nullopt;
+    }
+
+    void validateDeInputs(const std::function<double(double)>& f, double tolerance, int max_levels) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie moze byc pusta.");
+        }
+        if (tolerance <= 0) {
+            throw std::invalid_argument("Tolerancja musi byc dodatnia.");
+        }
+        if (max_levels <= 0 || max_levels > 12) {
+            throw std::invalid_argument("Liczba poziomow musi nalezec do przedzialu [1, 12].");
+        }
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+std::optional<IntegrationResult> tanhSinhIntegration(const std::function<double(double)>& f, double a, double b,
+                                                     double tolerance, int max_levels) {
+    validateDeInputs(f, tolerance, max_levels);
+    if (a >= b) {
+        throw std::invalid_argument("Dolna granica (a) musi byc mniejsza od gornej (b).");
+    }
+    double half = (b - a) / 2.0;
+    return deIntegrate(DeKind::TanhSinh, half, tolerance, max_levels, [&](const DeNode& node, int& evaluations) {
+        double sum = 0.0;
+        double left = a + half * node.x;
+        // Wezly, ktore po zaokragleniu trafiaja w koniec przedzialu, sa pomijane (ich waga jest znikoma)
+        if (left > a && left < b) {
+            sum += node.w * f(left);
+            ++evaluations;
+        }
+        double right = b - half * node.x;
+        if (node.mirrored && right > a && right < b) {
+            sum += node.w * f(right);
+            ++evaluations;
+        }
+        return sum;
+    });
+}
+
+std::optional<IntegrationResult> expSinhIntegration(const std::function<double(double)>& f, double a,
+                                                    double tolerance, int max_levels) {
+    validateDeInputs(f, tolerance, max_levels);
+    return deIntegrate(DeKind::ExpSinh, 1.0, tolerance, max_levels, [&](const DeNode& node, int& evaluations) {
+        double x = a + node.x;
+        if (!(x > a) || std::isinf(x)) {
+            return 0.0;
+        }
+        ++evaluations;
+        return node.w * f(x);
+    });
+}
+
+std::optional<IntegrationResult> sinhSinhIntegration(const std::function<double(double)>& f,
+                                                     double tolerance, int max_levels) {
+    validateDeInputs(f, tolerance, max_levels);
+    return deIntegrate(DeKind::SinhSinh, 1.0, tolerance, max_levels, [&](const DeNode& node, int& evaluations) {
+        double sum = node.w * f(node.x);
+        ++evaluations;
+        if (node.mirrored) {
+            sum += node.w * f(-node.x);
+            ++evaluations;
+        }
+        return sum;
+    });
+}
+
+namespace {
+    struct GaussTable {
+        std::vector<double> x;
+        std::vector<double> w;
+    };
+
+    // Wartosci wlasne symetrycznej macierzy trojdiagonalnej (niejawna metoda QL) wraz z pierwszymi
+    // skladowymi wektorow wlasnych - tyle wystarcza do wag w algorytmie Golub-Welscha.
+    // diag - przekatna, off[i] - element (i, i+1); z na wejsciu to (1, 0, ..., 0).
+    void tridiagonalEigen(std::vector<double>& diag, std::vector<double>& off, std::vector<double>& z) {
+        const int n = static_cast<int>(diag.size());
+        off.resize(n, 0.0);
+        for (int l = 0; l < n; ++l) {
+            int iter = 0;
+            int m;
+            do {
+                for (m = l; m < n - 1; ++m) {
+                    double dd = std::abs(diag[m]) + std::abs(diag[m + 1]);
+                    if (std::abs(off[m]) <= std::numeric_limits<double>::epsilon() * dd) {
+                        break;
+                    }
+                }
+                if (m != l) {
+                    if (++iter > 60) {
+                        throw std::runtime_error("Brak zbieznosci przy wyznaczaniu wezlow kwadratury.");
+                    }
+                    double g = (diag[l + 1] - diag[l]) / (2.0 * off[l]);
+                    double r = std::hypot(g, 1.0);
+                    g = diag[m] - diag[l] + off[l] / (g + std::copysign(r, g));
+                    double s = 1.0, c = 1.0, p = 0.0;
+                    int i;
+                    for (i = m - 1; i >= l; --i) {
+                        double f = s * off[i];
+                        double b = c * off[i];
+                        r = std::hypot(f, g);
+                        off[i + 1] = r;
+                        if (r == 0.0) {
+                            diag[i + 1] -= p;
+                            off[m] = 0.0;
+                            break;
+                        }
+                        s = f / r;
+                        c = g / r;
+                        g = diag[i + 1] - p;
+                        r = (diag[i] - g) * s + 2.0 * c * b;
+                        p = s * r;
+                        diag[i + 1] = g + p;
+                        g = c * r - b;
+                        double zf = z[i + 1];
+                        z[i + 1] = s * z[i] + c * zf;
+                        z[i] = c * z[i] - s * zf;
+                    }
+                    if (r == 0.0 && i >= l) {
+                        continue;
+                    }
+                    diag[l] -= p;
+                    off[l] = g;
+                    off[m] = 0.0;
+                }
+            } while (m != l);
+        }
+    }
+
+    // Golub-Welsch: wezly to wartosci wlasne macierzy Jacobiego, wagi to mu0 * (pierwsza skladowa)^2
+    GaussTable golubWelsch(std::vector<double> diag, std::vector<double> off, double mu0) {
+        const std::size_t n = diag.size();
+        std::vector<double> z(n, 0.0);
+        z[0] = 1.0;
+        tridiagonalEigen(diag, off, z);
+
+        std::vector<std::size_t> order(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&diag](std::size_t i, std::size_t j) { return diag[i] < diag[j]; });
+        GaussTable table;
+        table.x.reserve(n);
+        table.w.reserve(n);
+        for (std::size_t i : order) {
+            table.x.push_back(diag[i]);
+            table.w.push_back(mu0 * z[i] * z[i]);
+        }
+        return table;
+    }
+
+    enum class WeightKind { Laguerre, Hermite };
+
+    const GaussTable& weightedGaussTable(WeightKind kind, int n, double param) {
+        static std::map<std::tuple<int, int, double>, GaussTable> cache;
+        static std::mutex cache_mutex;
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto key = std::make_tuple(static_cast<int>(kind), n, param);
+        auto it = cache.find(key);
+        if (it != cache.end()) {
+            return it->second;
+        }
+
+        std::vector<double> diag(n), off(n > 1 ? n - 1 : 0);
+        double mu0;
+        if (kind == WeightKind::Laguerre) {
+            for (int i = 0; i < n; ++i) {
+                diag[i] = 2.0 * i + param + 1.0;
+            }
+            for (int i = 1; i < n; ++i) {
+                off[i - 1] = std::sqrt(i * (i + param));
+            }
+            mu0 = std::tgamma(param + 1.0);
+        } else {
+            for (int i = 1; i < n; ++i) {
+                off[i - 1] = std::sqrt((i + ((i % 2 != 0) ? 2.0 * param : 0.0)) / 2.0);
+            }
+            mu0 = std::tgamma(param + 0.5);
+        }
+        return cache.emplace(key, golubWelsch(std::move(diag), std::move(off), mu0)).first->second;
+    }
+
+    double weightedGaussSum(const std::function<double(double)>& f, const GaussTable& table) {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < table.x.size(); ++i) {
+            // Wagi skrajnych wezlow wysokich rzedow znikaja - nie wywolujemy wtedy f
+            if (table.w[i] != 0.0) {
+                sum += table.w[i] * f(table.x[i]);
+            }
+        }
+        return sum;
+    }
+
+    void validateWeightedGaussInputs(const std::function<double(double)>& f, int nodes) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie moze byc pusta.");
+        }
+        if (nodes <= 0 || nodes > 1000) {
+            throw std::invalid_argument("Liczba wezlow musi nalezec do przedzialu [1, 1000].");
+        }
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+double gaussLaguerre(const std::function<double(double)>& f, int nodes, double alpha) {
+    validateWeightedGaussInputs(f, nodes);
+    if (alpha <= -1.0) {
+        throw std::invalid_argument("Parametr alpha musi byc wiekszy od -1.");
+    }
+    return weightedGaussSum(f, weightedGaussTable(WeightKind::Laguerre, nodes, alpha));
+}
+
+double gaussHermite(const std::function<double(double)>& f, int nodes, double mu) {
+    validateWeightedGaussInputs(f, nodes);
+    if (mu <= -0.5) {
+        throw std::invalid_argument("Parametr mu musi byc wiekszy od -1/2.");
+    }
+    return weightedGaussSum(f, weightedGaussTable(WeightKind::Hermite, nodes, mu));
+}
+
+namespace {
+    void validateVectorInputs(const VectorFunction& f, std::size_t components) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie moze byc pusta.");
+        }
+        if (components == 0) {
+            throw std::invalid_argument("Liczba skladowych musi byc dodatnia.");
+        }
+    }
+
+    // Akumulacja sum[k] += w * values[k] - prosta petla, ktora kompilator wektoryzuje
+    inline void axpy(double* sum, double w, const double* values, std::size_t n) {
+        for (std::size_t k = 0; k < n; ++k) {
+            sum[k] += w * values[k];
+        }
+    }
+
+    struct SimpsonPanel {
+        double a, b;
+        const double* fa;
+        const double* fm;
+        const double* fb;
+    };
+
+    // Rekurencyjny podzial wspolnej siatki; wartosci f w nowych punktach zyja w wycinku scratch
+    // [depth * 4n, (depth + 1) * 4n). Lewe poddrzewo konczy sie przed prawym, wiec wycinek na poziom wystarcza.
+    bool adaptiveSimpsonStep(const VectorFunction& f, std::size_t n, const SimpsonPanel& panel,
+                             const double* whole, double tolerance, int depth, double* scratch,
+                             VectorIntegrationResult& result) {
+        double m = 0.5 * (panel.a + panel.b);
+        double h = panel.b - panel.a;
+        double* flm = scratch + static_cast<std::size_t>(depth) * 4 * n;
+        double* frm = flm + n;
+        double* left = frm + n;
+        double* right = left + n;
+        f(0.5 * (panel.a + m), flm);
+        f(0.5 * (m + panel.b), frm);
+        result.evaluations += 2;
+
+        double max_error = 0.0;
+        for (std::size_t k = 0; k < n; ++k) {
+            left[k] = h / 12.0 * (panel.fa[k] + 4.0 * flm[k] + panel.fm[k]);
+            right[k] = h / 12.0 * (panel.fm[k] + 4.0 * frm[k] + panel.fb[k]);
+            max_error = std::max(max_error, std::abs(left[k] + right[k] - whole[k]) / 15.0);
+        }
+
+        if (max_error < tolerance) {
+            for (std::size_t k = 0; k < n; ++k) {
+                double refined = left[k] + right[k];
+                result.values[k] += refined + (refined - whole[k]) / 15.0;
+                result.error_estimates[k] += std::abs(refined - whole[k]) / 15.0;
+            }
+            return true;
+        }
+        if (depth <= 0) {
+            return false;
+        }
+        return adaptiveSimpsonStep(f, n, { panel.a, m, panel.fa, flm, panel.fm }, left, tolerance / 2.0, depth - 1,
+                                   scratch, result)
+            && adaptiveSimpsonStep(f, n, { m, panel.b, panel.fm, frm, panel.fb }, right, tolerance / 2.0, depth - 1,
+                                   scratch, result);
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+std::vector<double> segmentedGaussLegendreVector(const VectorFunction& f, std::size_t components,
+                                                 double a, double b, int nodes, int segments) {
+    validateVectorInputs(f, components);
+    if (segments <= 0) {
+        throw std::invalid_argument("Liczba segmentow musi byc dodatnia.");
+    }
+    const double* x_nodes;
+    const double* w_weights;
+    gaussTable(nodes, x_nodes, w_weights);
+
+    std::vector<double> sum(components, 0.0);
+    std::vector<double> values(components);
+    double h = (b - a) / static_cast<double>(segments);
+    double c1 = h / 2.0;
+    for (int i = 0; i < segments; ++i) {
+        double c2 = a + static_cast<double>(i) * h + c1;
+        for (int j = 0; j < nodes; ++j) {
+            f(c1 * x_nodes[j] + c2, values.data());
+            axpy(sum.data(), w_weights[j], values.data(), components);
+        }
+    }
+    for (double& s : sum) {
+        s *= c1;
+    }
+    return sum;
+}
+
+std::optional<VectorIntegrationResult> adaptiveSimpsonVector(const VectorFunction& f, std::size_t components,
+                                                             double a, double b, double tolerance, int max_depth) {
+    validateVectorInputs(f, components);
+    if (tolerance <= 0) {
+        throw std::invalid_argument("Tolerancja musi byc dodatnia.");
+    }
+    if (max_depth <= 0 || max_depth > 50) {
+        throw std::invalid_argument("Glebokosc podzialu musi nalezec do przedzialu [1, 50].");
+    }
+
+    const std::size_t n = components;
+    std::vector<double> buffer(4 * n);
+    double* fa = buffer.data();
+    double* fm = fa + n;
+    double* fb = fm + n;
+    double* whole = fb + n;
+    f(a, fa);
+    f(0.5 * (a + b), fm);
+    f(b, fb);
+    for (std::size_t k = 0; k < n; ++k) {
+        whole[k] = (b - a) / 6.0 * (fa[k] + 4.0 * fm[k] + fb[k]);
+    }
+
+    VectorIntegrationResult result{ std::vector<double>(n, 0.0), std::vector<double>(n, 0.0), 3 };
+    std::vector<double> scratch(static_cast<std::size_t>(max_depth + 1) * 4 * n); // Jedna alokacja na cale wywolanie
+    if (!adaptiveSimpsonStep(f, n, { a, b, fa, fm, fb }, whole, tolerance, max_depth, scratch.data(), result)) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+StreamingIntegrator::StreamingIntegrator(TabulatedRule rule, CumulativeCallback on_sample)
+    : rule_(rule), on_sample_(std::move(on_sample)) {}
+
+void StreamingIntegrator::addSample(double x, double y) {
+    if (count_ > 0 && !(x > xs_[2])) {
+        throw std::invalid_argument("Wartosci x musza byc scisle rosnace.");
+    }
+    xs_[0] = xs_[1]; ys_[0] = ys_[1];
+    xs_[1] = xs_[2]; ys_[1] = ys_[2];
+    xs_[2] = x;      ys_[2] = y;
+    ++count_;
+
+    if (count_ >= 2) {
+        if (rule_ == TabulatedRule::Trapezoidal) {
+            completed_ += 0.5 * (xs_[2] - xs_[1]) * (ys_[1] + ys_[2]);
+        } else if (count_ % 2 == 1) {
+            // Zamykamy pare przedzialow [x0, x1], [x1, x2] wzorem Simpsona dla niejednorodnego kroku
+            double h0 = xs_[1] - xs_[0];
+            double h1 = xs_[2] - xs_[1];
+            double hs = h0 + h1;
+            completed_ += hs / 6.0 * ((2.0 - h1 / h0) * ys_[0] + hs * hs / (h0 * h1) * ys_[1] + (2.0 - h0 / h1) * ys_[2]);
+        }
+    }
+    if (on_sample_) {
+        on_sample_(x, result());
+    }
+}
+
+void StreamingIntegrator::addSamples(const double* x, const double* y, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        addSample(x[i], y[i]);
+    }
+}
+
+double StreamingIntegrator::result() const {
+    if (rule_ == TabulatedRule::Trapezoidal || count_ % 2 == 1) {
+        return completed_;
+    }
+    if (count_ == 2) {
+        // Tylko jeden przedzial - pozostaje metoda trapezow
+        return completed_ + 0.5 * (xs_[2] - xs_[1]) * (ys_[1] + ys_[2]);
+    }
+    // Poprawka dla nieparzystego ostatniego przedzialu z trzech ostatnich punktow
+    double h0 = xs_[1] - xs_[0];
+    double h1 = xs_[2] - xs_[1];
+    double alpha = (2.0 * h1 * h1 + 3.0 * h0 * h1) / (6.0 * (h0 + h1));
+    double beta = (h1 * h1 + 3.0 * h0 * h1) / (6.0 * h0);
+    double eta = h1 * h1 * h1 / (6.0 * h0 * (h0 + h1));
+    return completed_ + alpha * ys_[2] + beta * ys_[1] - eta * ys_[0];
+}
+
+namespace {
+    void validateChunkSize(std::size_t chunk_size) {
+        if (chunk_size == 0) {
+            throw std::invalid_argument("Rozmiar porcji musi byc dodatni.");
+        }
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+double integrateCsvStream(std::istream& in, TabulatedRule rule,
+                          const CumulativeCallback& on_sample, std::size_t chunk_size) {
+    validateChunkSize(chunk_size);
+    StreamingIntegrator integrator(rule, on_sample);
+    std::vector<double> xs, ys;
+    xs.reserve(chunk_size);
+    ys.reserve(chunk_size);
+    std::string line;
+    while (std::getline(in, line)) {
+        std::size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream fields(line);
+        double x, y;
+        if (!(fields >> x >> y)) {
+            throw std::runtime_error("Nieprawidlowa linia danych: oczekiwano dwoch liczb.");
+        }
+        xs.push_back(x);
+        ys.push_back(y);
+        if (xs.size() == chunk_size) {
+            integrator.addSamples(xs.data(), ys.data(), xs.size());
+            xs.clear();
+            ys.clear();
+        }
+    }
+    integrator.addSamples(xs.data(), ys.data(), xs.size());
+    return integrator.result();
+}
+
+double integrateBinaryStream(std::istream& in, TabulatedRule rule,
+                             const CumulativeCallback& on_sample, std::size_t chunk_size) {
+    validateChunkSize(chunk_size);
+    StreamingIntegrator integrator(rule, on_sample);
+    std::vector<double> buffer(2 * chunk_size);
+    while (in) {
+        in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(double)));
+        std::size_t bytes = static_cast<std::size_t>(in.gcount());
+        if (bytes % (2 * sizeof(double)) != 0) {
+            throw std::runtime_error("Strumien binarny konczy sie niepelnym rekordem (x, y).");
+        }
+        std::size_t records = bytes / (2 * sizeof(double));
+        for (std::size_t i = 0; i < records; ++i) {
+            integrator.addSample(buffer[2 * i], buffer[2 * i + 1]);
+        }
+    }
+    return integrator.result();
+}
+
+double integrateUniformBinaryStream(std::istream& in, double x0, double dx, TabulatedRule rule,
+                                    const CumulativeCallback& on_sample, std::size_t chunk_size) {
+    validateChunkSize(chunk_size);
+    if (dx <= 0) {
+        throw std::invalid_argument("Krok probkowania (dx) musi byc dodatni.");
+    }
+    StreamingIntegrator integrator(rule, on_sample);
+    std::vector<double> buffer(chunk_size);
+    long long index = 0;
+    while (in) {
+        in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(double)));
+        std::size_t bytes = static_cast<std::size_t>(in.gcount());
+        if (bytes % sizeof(double) != 0) {
+            throw std::runtime_error("Strumien binarny konczy sie niepelna wartoscia.");
+        }
+        std::size_t values = bytes / sizeof(double);
+        for (std::size_t i = 0; i < values; ++i, ++index) {
+            integrator.addSample(x0 + static_cast<double>(index) * dx, buffer[i]);
+        }
+    }
+    return integrator.result();
+}
+
 } // namespace integration
 } // namespace numeric
\ No newline at end of file
@@ -69,12 +69,26 @@ std::vector<double> luDecomposition(std::vector<std::vector<double>> A, std::vec
     if (n == 0 || A[0].size() != n || b.size() != n) {
         throw std::invalid_argument("Nieprawidłowe wymiary macierzy lub wektora.");
     }
-    
-    std::vector<std::vector<double>> L(n, std::vector<double>(n, 0.0));
-    std::vector<std::vector<double>>& U = A; // Używamy macierzy A jako U dla oszczędności pamięci
+    return luSolve(luFactorize(std::move(A)), b);
+}
+
+LuFactorization luFactorize(std::vector<std::vector<double>> A) {
+    const int n = static_cast<int>(A.size());
+    if (n == 0) {
+        throw std::invalid_argument("Nieprawidłowe wymiary macierzy.");
+    }
+    for (const auto& row : A) {
+        if (static_cast<int>(row.size()) != n) {
+            throw std::invalid_argument("Nieprawidłowe wymiary macierzy.");
+        }
+    }
+
+    LuFactorization result;
+    result.permutation.resize(n);
+    std::iota(result.permutation.begin(), result.permutation.end(), 0);
+    std::vector<std::vector<double>>& U = A; // L i U powstaja w miejscu macierzy A
 
-    // --- KROK 1: Dekompozycja LU z częściowym pivotingiem ---
-    for (int k = 0; k < n - 1; ++k) {
+    for (int k = 0; k < n; ++k) {
         // Znajdź wiersz z maksymalnym elementem (pivot)
         int max_row = k;
         for (int i = k + 1; i < n; ++i) {
@@ -82,12 +96,9 @@ std::vector<double> luDecomposition(std::vector<std::vector<double>> A, std::vec
                 max_row = i;
             }
         }
-
-        // Zamiana wierszy w U, L i b
         if (max_row != k) {
             std::swap(U[k], U[max_row]);
-            std::swap(b[k], b[max_row]); 
-            std::swap(L[k], L[max_row]);
+            std::swap(result.permutation[k], result.permutation[max_row]);
         }
 
         // Sprawdzenie osobliwości
@@ -95,48 +106,155 @@ std::vector<double> luDecomposition(std::vector<std::vector<double>> A, std::vec
             throw std::runtime_error("Macierz jest osobliwa, nie można kontynuowac dekompozycji.");
         }
 
-        // Eliminacja Gaussa
         for (int i = k + 1; i < n; ++i) {
             double factor = U[i][k] / U[k][k];
-            L[i][k] = factor;
-            for (int j = k; j < n; ++j) {
+            U[i][k] = factor;
+            for (int j = k + 1; j < n; ++j) {
                 U[i][j] -= factor * U[k][j];
             }
         }
     }
-    
-    // Uzupełnienie diagonali macierzy L
-    for (int i = 0; i < n; ++i) {
-        L[i][i] = 1.0;
+
+    result.lu = std::move(A);
+    return result;
+}
+
+void luSolve(const LuFactorization& factorization, const std::vector<double>& b, std::vector<double>& x) {
+    const auto& LU = factorization.lu;
+    const int n = static_cast<int>(LU.size());
+    if (static_cast<int>(b.size()) != n) {
+        throw std::invalid_argument("Nieprawidłowe wymiary wektora prawej strony.");
     }
+    x.resize(n);
 
-    // --- KROK 2: Podstawienie w przód (rozwiązanie Lz = b) ---
-    std::vector<double> z(n);
+    // Podstawienie w przód (Lz = Pb), z zapisywane w x
     for (int i = 0; i < n; ++i) {
-        double sum = 0.0;
+        double sum = b[factorization.permutation[i]];
         for (int j = 0; j < i; ++j) {
-            sum += L[i][j] * z[j];
+            sum -= LU[i][j] * x[j];
         }
-        z[i] = b[i] - sum;
+        x[i] = sum;
     }
 
-    // --- KROK 3: Podstawienie wstecz (rozwiązanie Ux = z) ---
-    std::vector<double> x(n);
+    // Podstawienie wstecz (Ux = z)
     for (int i = n - 1; i >= 0; --i) {
-        double sum = 0.0;
+        double sum = x[i];
         for (int j = i + 1; j < n; ++j) {
-            sum += U[i][j] * x[j];
-        }
-        if (std::abs(U[i][i]) < 1e-12) {
-            throw std::runtime_error("Dzielenie przez zero podczas podstawiania wstecz (macierz osobliwa).");
+            sum -= LU[i][j] * x[j];
         }
-        x[i] = (z[i] - sum) / U[i][i];
+        x[i] = sum / LU[i][i];
     }
+}
 
+std::vector<double> luSolve(const LuFactorization& factorization, const std::vector<double>& b) {
+    std::vector<double> x;
+    luSolve(factorization, b, x);
     return x;
 }
 
 
 
+void bandedMultiply(const BandedMatrix& A, const std::vector<double>& x, std::vector<double>& y) {
+    if (x.size() != A.n) {
+        throw std::invalid_argument("Rozmiar wektora nie zgadza sie z macierza.");
+    }
+    y.assign(A.n, 0.0);
+    for (std::size_t i = 0; i < A.n; ++i) {
+        const std::size_t j_begin = i >= A.lower ? i - A.lower : 0;
+        const std::size_t j_end = std::min(A.n - 1, i + A.upper);
+        double sum = 0.0;
+        for (std::size_t j = j_begin; j <= j_end; ++j) {
+            sum += A(i, j) * x[j];
+        }
+        y[i] = sum;
+    }
+}
+
+BandedLuFactorization bandedLuFactorize(const BandedMatrix& A) {
+    const std::size_t n = A.n;
+    if (n == 0 || A.band.size() != n * (A.lower + A.upper + 1)) {
+        throw std::invalid_argument("Nieprawidłowe wymiary macierzy wstegowej.");
+    }
+    BandedLuFactorization f;
+    f.n = n;
+    f.lower = A.lower;
+    f.upper = A.lower + A.upper;
+    const std::size_t width = f.lower + f.upper + 1;
+    f.lu.assign(n * width, 0.0);
+    f.pivots.resize(n);
+    auto at = [&f, width](std::size_t i, std::size_t j) -> double& { return f.lu[i * width + j + f.lower - i]; };
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t j_begin = i >= A.lower ? i - A.lower : 0;
+        const std::size_t j_end = std::min(n - 1, i + A.upper);
+        for (std::size_t j = j_begin; j <= j_end; ++j) {
+            at(i, j) = A(i, j);
+        }
+    }
+
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::size_t row_end = std::min(n - 1, k + f.lower);
+        const std::size_t col_end = std::min(n - 1, k + f.upper);
+        // Pivot wsrod wierszy, ktore moga miec niezerowy element w kolumnie k
+        std::size_t pivot = k;
+        for (std::size_t i = k + 1; i <= row_end; ++i) {
+            if (std::abs(at(i, k)) > std::abs(at(pivot, k))) {
+                pivot = i;
+            }
+        }
+        f.pivots[k] = pivot;
+        if (std::abs(at(pivot, k)) < 1e-12) {
+            throw std::runtime_error("Macierz jest osobliwa, nie można kontynuowac dekompozycji.");
+        }
+        if (pivot != k) {
+            for (std::size_t j = k; j <= col_end; ++j) {
+                std::swap(at(k, j), at(pivot, j));
+            }
+        }
+        for (std::size_t i = k + 1; i <= row_end; ++i) {
+            double factor = at(i, k) / at(k, k);
+            at(i, k) = factor;
+            if (factor != 0.0) {
+                for (std::size_t j = k + 1; j <= col_end; ++j) {
+                    at(i, j) -= factor * at(k, j);
+                }
+            }
+        }
+    }
+    return f;
+}
+
+void bandedLuSolve(const BandedLuFactorization& f, const std::vector<double>& b, std::vector<double>& x) {
+    const std::size_t n = f.n;
+    if (b.size() != n) {
+        throw std::invalid_argument("Rozmiar wektora b nie zgadza sie z rozkladem.");
+    }
+    const std::size_t width = f.lower + f.upper + 1;
+    auto at = [&f, width](std::size_t i, std::size_t j) { return f.lu[i * width + j + f.lower - i]; };
+    x = b;
+    // Zamiany wierszy i eliminacja w tej samej kolejnosci co przy rozkladzie
+    for (std::size_t k = 0; k < n; ++k) {
+        std::swap(x[k], x[f.pivots[k]]);
+        const std::size_t row_end = std::min(n - 1, k + f.lower);
+        for (std::size_t i = k + 1; i <= row_end; ++i) {
+            x[i] -= at(i, k) * x[k];
+        }
+    }
+    for (std::size_t k = n; k-- > 0;) {
+        const std::size_t col_end = std::min(n - 1, k + f.upper);
+        double sum = x[k];
+        for (std::size_t j = k + 1; j <= col_end; ++j) {
+            sum -= at(k, j) * x[j];
+        }
+        x[k] = sum / at(k, k);
+    }
+}
+
+std::vector<double> bandedLuSolve(const BandedLuFactorization& factorization, const std::vector<double>& b) {
+    std::vector<double> x;
+    bandedLuSolve(factorization, b, x);
+    return x;
+}
+
 } // namespace linear_algebra
-} // namespace numeric
\ No newline at end of file
+} // namespace numeric
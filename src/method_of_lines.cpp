@@ -0,0 +1,370 @@
+// src/method_of_lines.cpp
+
+#include "method_of_lines.h"
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include <limits>
+
+namespace numeric {
+namespace pde {
+
+namespace { // Anonimowa przestrzen nazw dla funkcji pomocniczych
+
+    // Jeden kierunek siatki: wezly min + i * step, i = 0..count-1
+    struct Axis {
+        std::size_t count = 1;
+        double min = 0.0;
+        double step = 0.0;
+        double diffusion = 0.0;
+        double velocity = 0.0;
+        Boundary low, high;
+    };
+
+    Axis makeAxis(double min, double max, std::size_t count, double diffusion, double velocity,
+                  const Boundary& low, const Boundary& high, const char* name) {
+        if (count < 3) {
+            throw std::invalid_argument(std::string("Siatka w kierunku ") + name + " musi miec co najmniej 3 wezly.");
+        }
+        if (!(max > min)) {
+            throw std::invalid_argument(std::string("Przedzial w kierunku ") + name + " musi byc niepusty (max > min).");
+        }
+        if (diffusion < 0) {
+            throw std::invalid_argument("Wspolczynnik dyfuzji nie moze byc ujemny.");
+        }
+        Axis axis;
+        axis.count = count;
+        axis.min = min;
+        axis.step = (max - min) / static_cast<double>(count - 1);
+        axis.diffusion = diffusion;
+        axis.velocity = velocity;
+        axis.low = low;
+        axis.high = high;
+        return axis;
+    }
+
+    // Wspolczynniki przy u_{i-1}, u_i, u_{i+1} operatora D u'' - a u' w jednym kierunku
+    struct Stencil {
+        double west = 0.0;
+        double center = 0.0;
+        double east = 0.0;
+    };
+
+    Stencil axisStencil(const Axis& axis, AdvectionScheme scheme) {
+        Stencil s;
+        const double h = axis.step;
+        const double d = axis.diffusion / (h * h);
+        s.west = d;
+        s.east = d;
+        s.center = -2.0 * d;
+        const double a = axis.velocity;
+        if (scheme == AdvectionScheme::Central) {
+            s.west += a / (2.0 * h);
+            s.east -= a / (2.0 * h);
+        } else if (a > 0) {
+            s.west += a / h;
+            s.center -= a / h;
+        } else {
+            s.east -= a / h;
+            s.center += a / h;
+        }
+        return s;
+    }
+
+    struct Entry {
+        std::size_t row;
+        std::size_t column;
+        double value;
+    };
+
+    struct Assembly {
+        linear_algebra::BandedMatrix matrix;
+        std::vector<double> constant;
+        std::vector<double> x, y;
+    };
+
+    // Wspolny montaz dla 1-D (ay.count == 1) i 2-D
+    class Assembler {
+    public:
+        Assembler(const Axis& ax, const Axis& ay, AdvectionScheme scheme)
+            : ax_(ax), ay_(ay), index_(ax.count * ay.count, kDirichlet) {
+            for (std::size_t j = 0; j < ay_.count; ++j) {
+                for (std::size_t i = 0; i < ax_.count; ++i) {
+                    if (!dirichletValue(i, j, nullptr)) {
+                        index_[j * ax_.count + i] = unknowns_++;
+                    }
+                }
+            }
+            if (unknowns_ == 0) {
+                throw std::invalid_argument("Siatka nie zawiera zadnych niewiadomych.");
+            }
+            sx_ = axisStencil(ax_, scheme);
+            if (ay_.count > 1) {
+                sy_ = axisStencil(ay_, scheme);
+            }
+        }
+
+        Assembly assemble() {
+            Assembly out;
+            out.constant.assign(unknowns_, 0.0);
+            out.x.resize(unknowns_);
+            out.y.resize(unknowns_);
+            constant_ = &out.constant;
+            for (std::size_t j = 0; j < ay_.count; ++j) {
+                for (std::size_t i = 0; i < ax_.count; ++i) {
+                    const std::size_t row = index_[j * ax_.count + i];
+                    if (row == kDirichlet) {
+                        continue;
+                    }
+                    out.x[row] = ax_.min + static_cast<double>(i) * ax_.step;
+                    out.y[row] = ay_.min + static_cast<double>(j) * ay_.step;
+                    couple(row, i, j, sx_.center + sy_.center);
+                    axisNeighbours(row, i, ax_, sx_, [&](std::size_t ii, double c) { couple(row, ii, j, c); });
+                    if (ay_.count > 1) {
+                        axisNeighbours(row, j, ay_, sy_, [&](std::size_t jj, double c) { couple(row, i, jj, c); });
+                    }
+                }
+            }
+
+            // Szerokosc pasma wynika z porzadku niewiadomych (w 2-D okolo nx)
+            std::size_t lower = 0, upper = 0;
+            for (const Entry& e : entries_) {
+                if (e.column < e.row) {
+                    lower = std::max(lower, e.row - e.column);
+                } else {
+                    upper = std::max(upper, e.column - e.row);
+                }
+            }
+            out.matrix = linear_algebra::BandedMatrix(unknowns_, lower, upper);
+            for (const Entry& e : entries_) {
+                out.matrix(e.row, e.column) += e.value;
+            }
+            return out;
+        }
+
+    private:
+        static constexpr std::size_t kDirichlet = std::numeric_limits<std::size_t>::max();
+
+        // Czy wezel lezy na brzegu Dirichleta; left/right maja pierwszenstwo przed bottom/top
+        bool dirichletValue(std::size_t i, std::size_t j, double* value) const {
+            const Boundary* b = nullptr;
+            if (i == 0 && ax_.low.type == BoundaryType::Dirichlet) {
+                b = &ax_.low;
+            } else if (i == ax_.count - 1 && ax_.high.type == BoundaryType::Dirichlet) {
+                b = &ax_.high;
+            } else if (ay_.count > 1 && j == 0 && ay_.low.type == BoundaryType::Dirichlet) {
+                b = &ay_.low;
+            } else if (ay_.count > 1 && j == ay_.count - 1 && ay_.high.type == BoundaryType::Dirichlet) {
+                b = &ay_.high;
+            }
+            if (b && value) {
+                *value = b->value;
+            }
+            return b != nullptr;
+        }
+
+        // Wspolczynnik c przy wezle (i, j): wyraz macierzy albo (dla wezla Dirichleta) wyraz staly
+        void couple(std::size_t row, std::size_t i, std::size_t j, double c) {
+            if (c == 0.0) {
+                return;
+            }
+            const std::size_t column = index_[j * ax_.count + i];
+            if (column == kDirichlet) {
+                double value = 0.0;
+                dirichletValue(i, j, &value);
+                (*constant_)[row] += c * value;
+            } else {
+                entries_.push_back({ row, column, c });
+            }
+        }
+
+        // Sasiedzi w jednym kierunku; poza siatka (tylko na brzegu Neumanna, bo wezly Dirichleta nie sa
+        // niewiadomymi) uzywamy punktu fikcyjnego u_{-1} = u_1 - 2h g lub u_N = u_{N-2} + 2h g
+        template <typename Couple>
+        void axisNeighbours(std::size_t row, std::size_t pos, const Axis& axis, const Stencil& s, Couple&& at) {
+            if (pos == 0) {
+                at(pos + 1, s.west);
+                (*constant_)[row] -= s.west * 2.0 * axis.step * axis.low.value;
+            } else {
+                at(pos - 1, s.west);
+            }
+            if (pos == axis.count - 1) {
+                at(pos - 1, s.east);
+                (*constant_)[row] += s.east * 2.0 * axis.step * axis.high.value;
+            } else {
+                at(pos + 1, s.east);
+            }
+        }
+
+        Axis ax_, ay_;
+        Stencil sx_, sy_;
+        std::vector<std::size_t> index_;   // Wezel (j * nx + i) -> numer niewiadomej lub kDirichlet
+        std::size_t unknowns_ = 0;
+        std::vector<double>* constant_ = nullptr;
+        std::vector<Entry> entries_;
+    };
+
+    std::size_t stepCount(double t0, double dt, double t_end) {
+        return static_cast<std::size_t>(std::floor((t_end - t0) / dt + 1e-9));
+    }
+
+} // namespace
+
+SemiDiscretization discretize(const Problem1D& problem) {
+    Axis ax = makeAxis(problem.x_min, problem.x_max, problem.points, problem.diffusion, problem.velocity,
+                       problem.left, problem.right, "x");
+    Axis ay; // Jeden wezel w kierunku y
+    Assembly assembly = Assembler(ax, ay, problem.advection).assemble();
+
+    SemiDiscretization result;
+    result.matrix_ = std::move(assembly.matrix);
+    result.constant_ = std::move(assembly.constant);
+    result.x_ = std::move(assembly.x);
+    result.y_ = std::move(assembly.y);
+    if (problem.source) {
+        auto source = problem.source;
+        result.source_ = [source](double x, double, double t) { return source(x, t); };
+    }
+    return result;
+}
+
+SemiDiscretization discretize(const Problem2D& problem) {
+    Axis ax = makeAxis(problem.x_min, problem.x_max, problem.nx, problem.diffusion, problem.velocity_x,
+                       problem.left, problem.right, "x");
+    Axis ay = makeAxis(problem.y_min, problem.y_max, problem.ny, problem.diffusion, problem.velocity_y,
+                       problem.bottom, problem.top, "y");
+    Assembly assembly = Assembler(ax, ay, problem.advection).assemble();
+
+    SemiDiscretization result;
+    result.matrix_ = std::move(assembly.matrix);
+    result.constant_ = std::move(assembly.constant);
+    result.x_ = std::move(assembly.x);
+    result.y_ = std::move(assembly.y);
+    result.source_ = problem.source;
+    return result;
+}
+
+std::vector<double> SemiDiscretization::sample(const std::function<double(double x, double y)>& u0) const {
+    if (!u0) {
+        throw std::invalid_argument("Funkcja u0 nie jest zdefiniowana (jest pusta).");
+    }
+    std::vector<double> u(size());
+    for (std::size_t i = 0; i < u.size(); ++i) {
+        u[i] = u0(x_[i], y_[i]);
+    }
+    return u;
+}
+
+void SemiDiscretization::rhs(double t, const std::vector<double>& u, std::vector<double>& dudt) const {
+    linear_algebra::bandedMultiply(matrix_, u, dudt);
+    for (std::size_t i = 0; i < dudt.size(); ++i) {
+        dudt[i] += constant_[i];
+    }
+    if (source_) {
+        for (std::size_t i = 0; i < dudt.size(); ++i) {
+            dudt[i] += source_(x_[i], y_[i], t);
+        }
+    }
+}
+
+ode::OdeSystemFunction SemiDiscretization::system() const {
+    SemiDiscretization copy = *this;
+    return [copy](double t, const std::vector<double>& u, std::vector<double>& dudt) { copy.rhs(t, u, dudt); };
+}
+
+double SemiDiscretization::explicitStepLimit() const {
+    // Wartosci wlasne leza w kolach Gerszgorina |z - a_ii| <= r_i. Kolo lezy w obszarze stabilnosci Eulera
+    // |1 + dt z| <= 1 wtedy i tylko wtedy, gdy r_i <= |a_ii| (a_ii <= 0) oraz dt * (|a_ii| + r_i) <= 2.
+    // Warunek r_i <= |a_ii| nie zachodzi np. dla adwekcji centralnej przy liczbie Pecleta siatki > 2.
+    double bound = 0.0;
+    for (std::size_t i = 0; i < matrix_.n; ++i) {
+        const std::size_t j_begin = i >= matrix_.lower ? i - matrix_.lower : 0;
+        const std::size_t j_end = std::min(matrix_.n - 1, i + matrix_.upper);
+        double off_diagonal = 0.0;
+        for (std::size_t j = j_begin; j <= j_end; ++j) {
+            if (j != i) {
+                off_diagonal += std::abs(matrix_(i, j));
+            }
+        }
+        const double diagonal = std::abs(matrix_(i, i));
+        // Tolerancja na zaokraglenia: dla upwind i brzegow Neumanna r_i = |a_ii| dokladnie
+        if (off_diagonal > diagonal * (1.0 + 1e-12)) {
+            throw std::runtime_error("Kryterium Gerszgorina nie gwarantuje stabilnosci jawnej metody Eulera "
+                                     "dla zadnego kroku (np. adwekcja centralna przy duzej liczbie Pecleta).");
+        }
+        bound = std::max(bound, diagonal + off_diagonal);
+    }
+    return bound > 0.0 ? 2.0 / bound : std::numeric_limits<double>::infinity();
+}
+
+void thetaMethod(const SemiDiscretization& system, const std::vector<double>& u0, double t0, double dt,
+                 double t_end, double theta, const ode::SystemObserver& observer) {
+    const std::size_t n = system.size();
+    if (u0.size() != n) {
+        throw std::invalid_argument("Rozmiar stanu poczatkowego (u0) nie zgadza sie z poldyskretyzacja.");
+    }
+    if (dt <= 0) {
+        throw std::invalid_argument("Krok czasowy (dt) musi byc dodatni.");
+    }
+    if (t_end < t0) {
+        throw std::invalid_argument("Chwila koncowa (t_end) nie moze byc mniejsza od poczatkowej (t0).");
+    }
+    if (!(theta >= 0.0 && theta <= 1.0)) {
+        throw std::invalid_argument("Parametr theta musi nalezec do przedzialu [0, 1].");
+    }
+    if (!observer) {
+        throw std::invalid_argument("Obserwator nie jest zdefiniowany (jest pusty).");
+    }
+
+    // M = I - theta dt A ma ten sam ksztalt pasma co A; rozklad raz na cale calkowanie
+    const linear_algebra::BandedMatrix& A = system.matrix();
+    linear_algebra::BandedMatrix M = A;
+    for (double& value : M.band) {
+        value *= -theta * dt;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        M(i, i) += 1.0;
+    }
+    const linear_algebra::BandedLuFactorization lu = linear_algebra::bandedLuFactorize(M);
+
+    const std::size_t steps = stepCount(t0, dt, t_end);
+    std::vector<double> u = u0;
+    std::vector<double> f_old(n), f_new(n), rhs(n);
+    const std::vector<double> zero(n, 0.0);
+    // Czesc niezalezna od u: b + s(t); f_old dla kroku n liczymy raz (jest to f_new poprzedniego kroku)
+    system.rhs(t0, zero, f_old);
+    std::vector<double> Au(n);
+    for (std::size_t step = 0; step <= steps; ++step) {
+        const double t = t0 + static_cast<double>(step) * dt;
+        observer(t, u);
+        if (step == steps) {
+            break;
+        }
+        system.rhs(t + dt, zero, f_new);
+        linear_algebra::bandedMultiply(A, u, Au);
+        for (std::size_t i = 0; i < n; ++i) {
+            rhs[i] = u[i] + dt * ((1.0 - theta) * Au[i] + theta * f_new[i] + (1.0 - theta) * f_old[i]);
+        }
+        linear_algebra::bandedLuSolve(lu, rhs, u);
+        std::swap(f_old, f_new);
+    }
+}
+
+ode::SystemSolution thetaMethod(const SemiDiscretization& system, const std::vector<double>& u0, double t0,
+                                double dt, double t_end, double theta) {
+    ode::SystemSolution solution;
+    solution.dimension = system.size();
+    if (dt > 0 && t_end >= t0) {
+        const std::size_t points = stepCount(t0, dt, t_end) + 1;
+        solution.x.reserve(points);
+        solution.y.reserve(points * solution.dimension);
+    }
+    thetaMethod(system, u0, t0, dt, t_end, theta, [&solution](double t, const std::vector<double>& u) {
+        solution.x.push_back(t);
+        solution.y.insert(solution.y.end(), u.begin(), u.end());
+    });
+    return solution;
+}
+
+} // namespace pde
+} // namespace numeric
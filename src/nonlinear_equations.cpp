@@ -1,12 +1,82 @@
 // src/nonlinear_equations.cpp
 
 #include "nonlinear_equations.h"
+#include "parallel.h"
+#include "linear_algebra.h"
 #include <cmath>
 #include <limits>
+#include <algorithm>
 
 namespace numeric {
 namespace nonlinear {
 
+namespace { // Anonimowa przestrzen nazw dla funkcji pomocniczych
+
+    // Stan metody Brenta-Dekkera: b - najlepsze przyblizenie, c - przeciwny koniec przedzialu, a - poprzednie b.
+    // Wspolny dla wersji skalarnej i wsadowej, w ktorej kazdy problem ma wlasny stan.
+    struct BrentState {
+        double a = 0.0, b = 0.0, c = 0.0, d = 0.0, e = 0.0;
+        double fa = 0.0, fb = 0.0, fc = 0.0;
+
+        BrentState() = default;
+        BrentState(double a_, double b_, double fa_, double fb_)
+            : a(a_), b(b_), c(a_), d(b_ - a_), e(b_ - a_), fa(fa_), fb(fb_), fc(fa_) {}
+
+        // Zwraca true, jesli b jest pierwiastkiem z dokladnoscia epsilon; w przeciwnym razie przesuwa b
+        // do kolejnego punktu, w ktorym wywolujacy musi policzyc fb = f(b)
+        bool advance(double epsilon) {
+            if ((fb > 0) == (fc > 0)) {
+                c = a;
+                fc = fa;
+                d = e = b - a;
+            }
+            if (std::abs(fc) < std::abs(fb)) {
+                a = b; b = c; c = a;
+                fa = fb; fb = fc; fc = fa;
+            }
+            const double tol = 2.0 * std::numeric_limits<double>::epsilon() * std::abs(b) + 0.5 * epsilon;
+            const double m = 0.5 * (c - b);
+            if (std::abs(m) <= tol || fb == 0.0) {
+                return true;
+            }
+            if (std::abs(e) < tol || std::abs(fa) <= std::abs(fb)) {
+                d = e = m; // Poprzedni krok byl za maly - bisekcja
+            } else {
+                double p, q;
+                const double s = fb / fa;
+                if (a == c) {
+                    // Tylko dwa rozne punkty - sieczna
+                    p = 2.0 * m * s;
+                    q = 1.0 - s;
+                } else {
+                    // Interpolacja odwrotna kwadratowa
+                    const double qa = fa / fc;
+                    const double r = fb / fc;
+                    p = s * (2.0 * m * qa * (qa - r) - (b - a) * (r - 1.0));
+                    q = (qa - 1.0) * (r - 1.0) * (s - 1.0);
+                }
+                if (p > 0) {
+                    q = -q;
+                } else {
+                    p = -p;
+                }
+                // Krok interpolacyjny tylko wtedy, gdy zostaje w przedziale i maleje wystarczajaco szybko
+                if (2.0 * p < std::min(3.0 * m * q - std::abs(tol * q), std::abs(e * q))) {
+                    e = d;
+                    d = p / q;
+                } else {
+                    d = e = m;
+                }
+            }
+            a = b;
+            fa = fb;
+            b += std::abs(d) > tol ? d : (m > 0 ? tol : -tol);
+            return false;
+        }
+    };
+
+} // namespace
+
 std::optional<double> bisectionMethod(const NonLinearFunction& f, double a, double b, double epsilon, int max_iter) {
     if (!f || a >= b || epsilon <= 0 || max_iter <= 0) {
         throw std::invalid_argument("Nieprawidlowe argumenty dla metody bisekcji.");
@@ -153,6 +223,1226 @@ std::optional<double> regulaFalsiMethod(const NonLinearFunction& f, double a, do
     return std::nullopt;
 }
 
+std::optional<RootResult> brentMethod(const NonLinearFunction& f, double a, double b, double epsilon, int max_iter) {
+    if (!f || a >= b || epsilon <= 0 || max_iter <= 0) {
+        throw std::invalid_argument("Nieprawidlowe argumenty dla metody Brenta.");
+    }
+
+    RootResult result;
+    double fa = f(a);
+    double fb = f(b);
+    result.evaluations = 2;
+    if (fa == 0.0 || fb == 0.0) {
+        result.root = fa == 0.0 ? a : b;
+        return result;
+    }
+    if ((fa > 0) == (fb > 0)) {
+        return std::nullopt;
+    }
+
+    BrentState state(a, b, fa, fb);
+    for (int i = 1; i <= max_iter; ++i) {
+        if (state.advance(epsilon)) {
+            result.root = state.b;
+            result.iterations = i;
+            return result;
+        }
+        state.fb = f(state.b);
+        ++result.evaluations;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<RootResult> chandrupatlaMethod(const NonLinearFunction& f, double a, double b, double epsilon, int max_iter) {
+    if (!f || a >= b || epsilon <= 0 || max_iter <= 0) {
+        throw std::invalid_argument("Nieprawidlowe argumenty dla metody Chandrupatli.");
+    }
+
+    RootResult result;
+    double fa = f(a);
+    double fb = f(b);
+    result.evaluations = 2;
+    if (fa == 0.0 || fb == 0.0) {
+        result.root = fa == 0.0 ? a : b;
+        return result;
+    }
+    if ((fa > 0) == (fb > 0)) {
+        return std::nullopt;
+    }
+
+    // a - ostatni punkt, b - przeciwny koniec przedzialu, c - punkt odrzucony w ostatnim kroku
+    double c = a, fc = fa;
+    double t = 0.5;
+    for (int i = 1; i <= max_iter; ++i) {
+        const double xt = a + t * (b - a);
+        const double ft = f(xt);
+        ++result.evaluations;
+        if ((ft > 0) == (fa > 0)) {
+            c = a;
+            fc = fa;
+        } else {
+            c = b;
+            fc = fb;
+            b = a;
+            fb = fa;
+        }
+        a = xt;
+        fa = ft;
+
+        const bool a_better = std::abs(fa) < std::abs(fb);
+        const double xm = a_better ? a : b;
+        const double fm = a_better ? fa : fb;
+        const double tol = 2.0 * std::numeric_limits<double>::epsilon() * std::abs(xm) + 0.5 * epsilon;
+        const double tl = tol / std::abs(b - c);
+        if (tl > 0.5 || fm == 0.0) {
+            result.root = xm;
+            result.iterations = i;
+            return result;
+        }
+
+        // Interpolacja odwrotna kwadratowa tylko w obszarze, w ktorym jej wynik lezy w przedziale (a, b)
+        const double xi = (a - b) / (c - b);
+        const double phi = (fa - fb) / (fc - fb);
+        if (1.0 - std::sqrt(1.0 - xi) < phi && phi < std::sqrt(xi)) {
+            t = fa / (fb - fa) * fc / (fb - fc) + (c - a) / (b - a) * fa / (fc - fa) * fb / (fc - fb);
+        } else {
+            t = 0.5;
+        }
+        t = std::min(std::max(t, tl), 1.0 - tl);
+    }
+
+    return std::nullopt;
+}
+
+std::optional<RootResult> itpMethod(const NonLinearFunction& f, double a, double b, double epsilon, int max_iter) {
+    if (!f || a >= b || epsilon <= 0 || max_iter <= 0) {
+        throw std::invalid_argument("Nieprawidlowe argumenty dla metody ITP.");
+    }
+
+    RootResult result;
+    double fa = f(a);
+    double fb = f(b);
+    result.evaluations = 2;
+    if (fa == 0.0 || fb == 0.0) {
+        result.root = fa == 0.0 ? a : b;
+        return result;
+    }
+    if ((fa > 0) == (fb > 0)) {
+        return std::nullopt;
+    }
+    // Sprowadzamy do przypadku f(a) < 0 < f(b)
+    const double sign = fa < 0 ? 1.0 : -1.0;
+    fa *= sign;
+    fb *= sign;
+
+    // Parametry zalecane przez Oliveire i Takahashiego: k1 = 0.2 / (b - a), k2 = 2, n0 = 1
+    const double k1 = 0.2 / (b - a);
+    const int n_half = std::max(0, static_cast<int>(std::ceil(std::log2((b - a) / (2.0 * epsilon)))));
+    const int n_max = n_half + 1;
+    int j = 0;
+    while (b - a > 2.0 * epsilon) {
+        if (j >= max_iter) {
+            return std::nullopt;
+        }
+        const double x_half = 0.5 * (a + b);
+        const double r = epsilon * std::ldexp(1.0, n_max - j) - 0.5 * (b - a);
+        const double delta = k1 * (b - a) * (b - a);
+        // Interpolacja (regula falsi) i przesuniecie w strone srodka
+        const double x_f = (fb * a - fa * b) / (fb - fa);
+        const double sigma = x_half >= x_f ? 1.0 : -1.0;
+        const double x_t = delta <= std::abs(x_half - x_f) ? x_f + sigma * delta : x_half;
+        // Rzut na otoczenie srodka gwarantujace zbieznosc w n_max krokach
+        double x_itp = std::abs(x_t - x_half) <= r ? x_t : x_half - sigma * r;
+        // Przy przedziale rzedu kilku epsilon regula falsi przykleja sie do konca o |f| na poziomie bledow
+        // zaokraglen; odsuniecie o epsilon / 2 (w strone srodka, wiec bez utraty gwarancji) konczy iteracje
+        x_itp = std::min(std::max(x_itp, a + 0.5 * epsilon), b - 0.5 * epsilon);
+        const double y = sign * f(x_itp);
+        ++result.evaluations;
+        ++j;
+        if (y > 0) {
+            b = x_itp;
+            fb = y;
+        } else if (y < 0) {
+            a = x_itp;
+            fa = y;
+        } else {
+            a = b = x_itp;
+        }
+    }
+
+    result.root = 0.5 * (a + b);
+    result.iterations = j;
+    return result;
+}
+
+std::optional<RootResult> multisectionMethod(const NonLinearFunction& f, double a, double b, int sections,
+                                             double epsilon, int max_iter, int threads) {
+    if (!f || a >= b || sections < 2 || epsilon <= 0 || max_iter <= 0) {
+        throw std::invalid_argument("Nieprawidlowe argumenty dla metody wielopodzialu.");
+    }
+    if (threads <= 0) {
+        throw std::invalid_argument("Liczba watkow musi byc dodatnia.");
+    }
+
+    RootResult result;
+    double fa = f(a);
+    double fb = f(b);
+    result.evaluations = 2;
+    if (fa * fb >= 0) {
+        // Warunek konieczny jak w metodzie bisekcji
+        return std::nullopt;
+    }
+
+    const std::size_t interior = static_cast<std::size_t>(sections - 1);
+    std::vector<double> x(interior), fx(interior);
+    for (int i = 1; i <= max_iter; ++i) {
+        const double width = (b - a) / static_cast<double>(sections);
+        for (std::size_t k = 0; k < interior; ++k) {
+            x[k] = a + static_cast<double>(k + 1) * width;
+        }
+        parallel::parallelFor(interior, threads, [&](std::size_t k, std::size_t) { fx[k] = f(x[k]); });
+        result.evaluations += static_cast<int>(interior);
+        result.iterations = i;
+
+        // Punkt o najmniejszym |f| konczy iteracje, jesli |f| < epsilon
+        std::size_t best = 0;
+        for (std::size_t k = 1; k < interior; ++k) {
+            if (std::abs(fx[k]) < std::abs(fx[best])) {
+                best = k;
+            }
+        }
+        if (std::abs(fx[best]) < epsilon) {
+            result.root = x[best];
+            return result;
+        }
+
+        // Pierwszy podprzedzial ze zmiana znaku
+        double lo = a, flo = fa;
+        double hi = b, fhi = fb;
+        for (std::size_t k = 0; k < interior; ++k) {
+            if (flo * fx[k] < 0) {
+                hi = x[k];
+                fhi = fx[k];
+                break;
+            }
+            lo = x[k];
+            flo = fx[k];
+        }
+        a = lo;
+        fa = flo;
+        b = hi;
+        fb = fhi;
+        if (std::abs(b - a) < epsilon) {
+            result.root = a + (b - a) / 2.0;
+            return result;
+        }
+    }
+
+    return std::nullopt;
+}
+
+// === Wsadowe wyznaczanie pierwiastkow ===
+
+namespace {
+
+    constexpr std::size_t kRootBlock = 256;
+
+    void validateBatchInputs(bool has_function, std::size_t count, double epsilon, int max_iter, int threads) {
+        if (!has_function) {
+            throw std::invalid_argument("Funkcja f nie moze byc pusta.");
+        }
+        if (count == 0) {
+            throw std::invalid_argument("Lista problemow nie moze byc pusta.");
+        }
+        if (epsilon <= 0 || max_iter <= 0) {
+            throw std::invalid_argument("Dokladnosc i maksymalna liczba iteracji musza byc dodatnie.");
+        }
+        if (threads <= 0) {
+            throw std::invalid_argument("Liczba watkow musi byc dodatnia.");
+        }
+    }
+
+    void validateBrackets(const std::vector<double>& a, const std::vector<double>& b) {
+        if (a.size() != b.size()) {
+            throw std::invalid_argument("Wektory a i b musza miec ten sam rozmiar.");
+        }
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (!(a[i] < b[i])) {
+                throw std::invalid_argument("Kazdy przedzial musi spelniac a < b.");
+            }
+        }
+    }
+
+    BatchRootResult makeBatchResult(std::size_t count) {
+        BatchRootResult result;
+        result.roots.assign(count, 0.0);
+        result.converged.assign(count, 0);
+        result.iterations.assign(count, 0);
+        return result;
+    }
+
+    // Dzieli problemy na bloki i sumuje liczbe wartosci f; block(first, count, worker) zwraca liczbe wywolan w bloku
+    template <typename Block>
+    std::size_t forEachBlock(std::size_t count, int threads, Block&& block) {
+        const std::size_t blocks = (count + kRootBlock - 1) / kRootBlock;
+        std::vector<std::size_t> evaluations(blocks, 0);
+        parallel::parallelFor(blocks, threads, [&](std::size_t b, std::size_t worker) {
+            const std::size_t first = b * kRootBlock;
+            evaluations[b] = block(first, std::min(kRootBlock, count - first), worker);
+        });
+        std::size_t total = 0;
+        for (std::size_t e : evaluations) {
+            total += e;
+        }
+        return total;
+    }
+
+} // namespace
+
+std::size_t BatchRootResult::failures() const {
+    std::size_t failed = 0;
+    for (unsigned char c : converged) {
+        failed += c ? 0 : 1;
+    }
+    return failed;
+}
+
+BatchRootResult newtonMethodBatch(const BatchDerivativeFunction& f, const std::vector<double>& x0,
+                                  double epsilon, int max_iter, int threads) {
+    validateBatchInputs(static_cast<bool>(f), x0.size(), epsilon, max_iter, threads);
+    BatchRootResult result = makeBatchResult(x0.size());
+
+    // Bufory bloku przydzielane raz na watek: x, nastepne x, f(x), f'(x) oraz maska aktywnych, flaga
+    // zbieznosci i licznik iteracji. Maski sa typu double, by petle aktualizacji operowaly na pasach
+    // jednej szerokosci i mogly byc wektoryzowane.
+    const std::size_t workers = static_cast<std::size_t>(threads);
+    std::vector<std::vector<double>> buffers(workers, std::vector<double>(7 * kRootBlock));
+
+    result.evaluations = forEachBlock(x0.size(), threads, [&](std::size_t first, std::size_t count, std::size_t w) {
+        double* x = buffers[w].data();
+        double* x_next = x + kRootBlock;
+        double* fx = x_next + kRootBlock;
+        double* dfx = fx + kRootBlock;
+        double* active = dfx + kRootBlock;
+        double* converged = active + kRootBlock;
+        double* steps = converged + kRootBlock;
+        const double eps = epsilon;
+        std::copy(x0.begin() + first, x0.begin() + first + count, x);
+        std::fill(active, active + count, 1.0);
+        std::fill(converged, converged + count, 0.0);
+        std::fill(steps, steps + count, 0.0);
+        std::size_t remaining = count;
+        std::size_t evaluations = 0;
+
+        for (int i = 0; i < max_iter && remaining > 0; ++i) {
+            f(x, fx, dfx, first, count);
+            evaluations += count;
+            // Krok liczony jest dla wszystkich problemow; przy zerowej pochodnej wynik jest odrzucany maska
+            for (std::size_t m = 0; m < count; ++m) {
+                x_next[m] = x[m] - fx[m] / dfx[m];
+                steps[m] += active[m];
+            }
+            // Zbieznosc wg |f(x)| lub dlugosci kroku, niepowodzenie przy pochodnej bliskiej zeru
+            for (std::size_t m = 0; m < count; ++m) {
+                const double xm = x[m];
+                const double xn = x_next[m];
+                const bool live = active[m] != 0.0;
+                const bool small = std::abs(fx[m]) < eps;
+                const bool flat = std::abs(dfx[m]) < std::numeric_limits<double>::epsilon();
+                const bool step = live & !small & !flat;
+                const bool done = std::abs(xn - xm) < eps;
+                converged[m] = (live & small) | (step & done) ? 1.0 : converged[m];
+                active[m] = step & !done ? 1.0 : 0.0;
+                x_next[m] = step ? xn : xm;
+            }
+            std::swap(x, x_next);
+            remaining = 0;
+            for (std::size_t m = 0; m < count; ++m) {
+                remaining += active[m] != 0.0 ? 1 : 0;
+            }
+        }
+        // Zapis wynikow; problemy, ktore nie zbiegly w max_iter iteracjach, zwracaja ostatnie przyblizenie
+        for (std::size_t m = 0; m < count; ++m) {
+            result.roots[first + m] = x[m];
+            result.converged[first + m] = converged[m] != 0.0 ? 1 : 0;
+            result.iterations[first + m] = static_cast<int>(steps[m]);
+        }
+        return evaluations;
+    });
+    return result;
+}
+
+BatchRootResult bisectionMethodBatch(const BatchRootFunction& f, const std::vector<double>& a,
+                                     const std::vector<double>& b, double epsilon, int max_iter, int threads) {
+    validateBatchInputs(static_cast<bool>(f), a.size(), epsilon, max_iter, threads);
+    validateBrackets(a, b);
+    BatchRootResult result = makeBatchResult(a.size());
+
+    // Na watek: konce przedzialow, wartosci na lewym koncu, punkty srodkowe i wartosci w nich oraz
+    // (jak w newtonMethodBatch) maska aktywnych, flaga zbieznosci i licznik iteracji
+    const std::size_t workers = static_cast<std::size_t>(threads);
+    std::vector<std::vector<double>> buffers(workers, std::vector<double>(8 * kRootBlock));
+
+    result.evaluations = forEachBlock(a.size(), threads, [&](std::size_t first, std::size_t count, std::size_t w) {
+        double* lo = buffers[w].data();
+        double* hi = lo + kRootBlock;
+        double* flo = hi + kRootBlock;
+        double* mid = flo + kRootBlock;
+        double* fmid = mid + kRootBlock;
+        double* active = fmid + kRootBlock;
+        double* converged = active + kRootBlock;
+        double* steps = converged + kRootBlock;
+        const double eps = epsilon;
+        std::copy(a.begin() + first, a.begin() + first + count, lo);
+        std::copy(b.begin() + first, b.begin() + first + count, hi);
+        std::fill(converged, converged + count, 0.0);
+        std::fill(steps, steps + count, 0.0);
+        f(lo, flo, first, count);
+        f(hi, fmid, first, count);
+        std::size_t evaluations = 2 * count;
+        std::size_t remaining = 0;
+        for (std::size_t m = 0; m < count; ++m) {
+            // Warunek konieczny jak w bisectionMethod
+            active[m] = flo[m] * fmid[m] < 0 ? 1.0 : 0.0;
+            remaining += active[m] != 0.0 ? 1 : 0;
+        }
+
+        for (int i = 0; i < max_iter && remaining > 0; ++i) {
+            // Wszystkie problemy bloku dziela te sama petle bez rozgalezien; nieaktywne licza f w starym punkcie
+            for (std::size_t m = 0; m < count; ++m) {
+                mid[m] = lo[m] + (hi[m] - lo[m]) / 2.0;
+                steps[m] += active[m];
+            }
+            f(mid, fmid, first, count);
+            evaluations += count;
+            // Najpierw zbieznosc (na starym przedziale), potem zawezenie przedzialow problemow nadal aktywnych.
+            // Przedzial zbieznego problemu juz sie nie zmienia, wiec mid pozostaje jego pierwiastkiem.
+            for (std::size_t m = 0; m < count; ++m) {
+                const double live = active[m];
+                const double c = converged[m];
+                const bool done = (live != 0.0) & ((std::abs(hi[m] - lo[m]) < eps) | (std::abs(fmid[m]) < eps));
+                converged[m] = done ? 1.0 : c;
+                active[m] = done ? 0.0 : live;
+            }
+            for (std::size_t m = 0; m < count; ++m) {
+                const double l = lo[m];
+                const double h = hi[m];
+                const double fl = flo[m];
+                const double md = mid[m];
+                const double fm = fmid[m];
+                const double live = active[m];
+                const double left = fl * fm < 0 ? live : 0.0; // Pierwiastek w lewej polowie
+                const double right = fl * fm < 0 ? 0.0 : live;
+                hi[m] = left != 0.0 ? md : h;
+                lo[m] = right != 0.0 ? md : l;
+                flo[m] = right != 0.0 ? fm : fl;
+            }
+            remaining = 0;
+            for (std::size_t m = 0; m < count; ++m) {
+                remaining += active[m] != 0.0 ? 1 : 0;
+            }
+        }
+        for (std::size_t m = 0; m < count; ++m) {
+            result.roots[first + m] = converged[m] != 0.0 ? mid[m] : 0.0;
+            result.converged[first + m] = converged[m] != 0.0 ? 1 : 0;
+            result.iterations[first + m] = static_cast<int>(steps[m]);
+        }
+        return evaluations;
+    });
+    return result;
+}
+
+BatchRootResult brentMethodBatch(const BatchRootFunction& f, const std::vector<double>& a,
+                                 const std::vector<double>& b, double epsilon, int max_iter, int threads) {
+    validateBatchInputs(static_cast<bool>(f), a.size(), epsilon, max_iter, threads);
+    validateBrackets(a, b);
+    BatchRootResult result = makeBatchResult(a.size());
+
+    const std::size_t workers = static_cast<std::size_t>(threads);
+    std::vector<std::vector<BrentState>> states(workers, std::vector<BrentState>(kRootBlock));
+    std::vector<std::vector<double>> buffers(workers, std::vector<double>(3 * kRootBlock));
+    std::vector<std::vector<unsigned char>> masks(workers, std::vector<unsigned char>(kRootBlock));
+
+    result.evaluations = forEachBlock(a.size(), threads, [&](std::size_t first, std::size_t count, std::size_t w) {
+        BrentState* state = states[w].data();
+        double* x = buffers[w].data();
+        double* fx = x + kRootBlock;
+        double* fa = fx + kRootBlock;
+        unsigned char* active = masks[w].data();
+        std::copy(a.begin() + first, a.begin() + first + count, x);
+        f(x, fa, first, count);
+        std::copy(b.begin() + first, b.begin() + first + count, x);
+        f(x, fx, first, count);
+        std::size_t evaluations = 2 * count;
+        std::size_t remaining = 0;
+        for (std::size_t m = 0; m < count; ++m) {
+            const std::size_t id = first + m;
+            active[m] = 0;
+            if (fa[m] == 0.0 || fx[m] == 0.0) {
+                result.roots[id] = fa[m] == 0.0 ? a[id] : b[id];
+                result.converged[id] = 1;
+            } else if ((fa[m] > 0) != (fx[m] > 0)) {
+                state[m] = BrentState(a[id], b[id], fa[m], fx[m]);
+                active[m] = 1;
+                ++remaining;
+            }
+        }
+
+        for (int i = 1; i <= max_iter && remaining > 0; ++i) {
+            for (std::size_t m = 0; m < count; ++m) {
+                if (!active[m]) {
+                    continue;
+                }
+                if (state[m].advance(epsilon)) {
+                    const std::size_t id = first + m;
+                    result.roots[id] = state[m].b;
+                    result.converged[id] = 1;
+                    result.iterations[id] = i;
+                    active[m] = 0;
+                    --remaining;
+                } else {
+                    x[m] = state[m].b;
+                }
+            }
+            if (remaining == 0) {
+                break;
+            }
+            f(x, fx, first, count);
+            evaluations += count;
+            for (std::size_t m = 0; m < count; ++m) {
+                if (active[m]) {
+                    state[m].fb = fx[m];
+                }
+            }
+        }
+        for (std::size_t m = 0; m < count; ++m) {
+            if (active[m]) {
+                result.roots[first + m] = state[m].b;
+                result.iterations[first + m] = max_iter;
+            }
+        }
+        return evaluations;
+    });
+    return result;
+}
+
+// === Wszystkie pierwiastki w przedziale ===
+
+namespace {
+
+    constexpr std::size_t kScanBlock = 256;
+
+    // Minimum funkcji unimodalnej na [lo, hi] zlotym podzialem
+    double goldenSectionMinimum(const NonLinearFunction& g, double lo, double hi, double epsilon, int max_iter) {
+        const double ratio = 0.5 * (std::sqrt(5.0) - 1.0);
+        double x1 = hi - ratio * (hi - lo);
+        double x2 = lo + ratio * (hi - lo);
+        double g1 = g(x1);
+        double g2 = g(x2);
+        for (int i = 0; i < max_iter; ++i) {
+            // Ponizej ~sqrt(eps) * |x| wartosci g nie rozrozniaja juz punktow
+            const double tol = std::max(epsilon, std::sqrt(std::numeric_limits<double>::epsilon()) * std::abs(x1));
+            if (hi - lo < tol) {
+                break;
+            }
+            if (g1 < g2) {
+                hi = x2;
+                x2 = x1;
+                g2 = g1;
+                x1 = hi - ratio * (hi - lo);
+                g1 = g(x1);
+            } else {
+                lo = x1;
+                x1 = x2;
+                g1 = g2;
+                x2 = lo + ratio * (hi - lo);
+                g2 = g(x2);
+            }
+        }
+        return g1 < g2 ? x1 : x2;
+    }
+
+    struct RootJob {
+        bool tangential;  // false - przedzial ze zmiana znaku, true - lokalne minimum |f|
+        double lo, hi;
+        double sign;      // Znak f w wezlach (tylko dla minimum)
+    };
+
+} // namespace
+
+std::vector<double> findAllRoots(const NonLinearFunction& f, double a, double b, const RootSearchOptions& options) {
+    if (!f || a >= b || options.subdivisions == 0 || options.epsilon <= 0 || options.max_iter <= 0 ||
+        options.tangent_tolerance < 0) {
+        throw std::invalid_argument("Nieprawidlowe argumenty dla wyszukiwania pierwiastkow.");
+    }
+    if (options.threads <= 0) {
+        throw std::invalid_argument("Liczba watkow musi byc dodatnia.");
+    }
+
+    // 1. Wartosci na siatce, blokami na watkach
+    const std::size_t n = options.subdivisions;
+    const double h = (b - a) / static_cast<double>(n);
+    std::vector<double> x(n + 1), fx(n + 1);
+    for (std::size_t i = 0; i <= n; ++i) {
+        x[i] = i == n ? b : a + static_cast<double>(i) * h;
+    }
+    parallel::parallelFor((n + kScanBlock) / kScanBlock, options.threads, [&](std::size_t block, std::size_t) {
+        const std::size_t end = std::min(n + 1, (block + 1) * kScanBlock);
+        for (std::size_t i = block * kScanBlock; i < end; ++i) {
+            fx[i] = f(x[i]);
+        }
+    });
+
+    // 2. Wezly bedace pierwiastkami, zmiany znaku i minima |f| bez zmiany znaku
+    std::vector<double> roots;
+    std::vector<RootJob> jobs;
+    for (std::size_t i = 0; i <= n; ++i) {
+        if (fx[i] == 0.0) {
+            roots.push_back(x[i]);
+        }
+        if (i < n && fx[i] * fx[i + 1] < 0) {
+            jobs.push_back({ false, x[i], x[i + 1], 0.0 });
+        }
+        if (options.detect_tangential && i > 0 && i < n && fx[i] != 0.0 &&
+            fx[i - 1] * fx[i] > 0 && fx[i] * fx[i + 1] > 0 &&
+            std::abs(fx[i]) < std::abs(fx[i - 1]) && std::abs(fx[i]) <= std::abs(fx[i + 1])) {
+            jobs.push_back({ true, x[i - 1], x[i + 1], fx[i] > 0 ? 1.0 : -1.0 });
+        }
+    }
+
+    // 3. Zawezanie wszystkich przedzialow rownolegle; minimum moze dac 0, 1 lub 2 pierwiastki
+    std::vector<std::vector<double>> found(jobs.size());
+    parallel::parallelFor(jobs.size(), options.threads, [&](std::size_t j, std::size_t) {
+        const RootJob& job = jobs[j];
+        if (!job.tangential) {
+            auto root = brentMethod(f, job.lo, job.hi, options.epsilon, options.max_iter);
+            if (root) {
+                found[j].push_back(root->root);
+            }
+            return;
+        }
+        const double sign = job.sign;
+        const double x_min = goldenSectionMinimum([&f, sign](double t) { return sign * f(t); },
+                                                  job.lo, job.hi, options.epsilon, options.max_iter);
+        const double f_min = f(x_min);
+        if (std::abs(f_min) <= options.tangent_tolerance) {
+            found[j].push_back(x_min); // Pierwiastek podwojny (lub blisko polozona para)
+        } else if (sign * f_min < 0) {
+            // Para pierwiastkow, ktora siatka przeoczyla
+            for (auto bracket : { std::make_pair(job.lo, x_min), std::make_pair(x_min, job.hi) }) {
+                auto root = brentMethod(f, bracket.first, bracket.second, options.epsilon, options.max_iter);
+                if (root) {
+                    found[j].push_back(root->root);
+                }
+            }
+        }
+    });
+    for (const auto& list : found) {
+        roots.insert(roots.end(), list.begin(), list.end());
+    }
+
+    // 4. Sortowanie i usuwanie powtorzen
+    std::sort(roots.begin(), roots.end());
+    std::vector<double> unique;
+    for (double root : roots) {
+        if (unique.empty() || root - unique.back() > 4.0 * options.epsilon) {
+            unique.push_back(root);
+        }
+    }
+    return unique;
+}
+
+// === Pierwiastki wielomianow ===
+
+namespace {
+
+    using Complex = std::complex<double>;
+
+    struct HornerResult {
+        Complex ratio;   // p(z) / p'(z)
+        bool small;      // |p(z)| ponizej progu bledu wstecznego
+    };
+
+    // p(z) / p'(z) i test bledu wstecznego; c w kolejnosci rosnacych poteg, c[n] != 0.
+    // Dla |z| > 1 liczymy q(w) = w^n p(1/w) (wspolczynniki odwrocone), bo z^n przepelnia sie juz dla n ~ 1000:
+    // p / p' = z q / (n q - w q').
+    HornerResult hornerRatio(const std::vector<double>& c, Complex z, double tolerance) {
+        const std::size_t n = c.size() - 1;
+        Complex value = 0.0, derivative = 0.0;
+        double bound = 0.0;
+        if (std::abs(z) <= 1.0) {
+            const double r = std::abs(z);
+            for (std::size_t k = n + 1; k-- > 0;) {
+                derivative = derivative * z + value;
+                value = value * z + c[k];
+                bound = bound * r + std::abs(c[k]);
+            }
+            return { value / derivative, std::abs(value) <= tolerance * bound };
+        }
+        const Complex w = 1.0 / z;
+        const double r = std::abs(w);
+        for (std::size_t k = 0; k <= n; ++k) {
+            derivative = derivative * w + value;
+            value = value * w + c[k];
+            bound = bound * r + std::abs(c[k]);
+        }
+        return { z * value / (static_cast<double>(n) * value - w * derivative), std::abs(value) <= tolerance * bound };
+    }
+
+    // Punkty startowe z gornej otoczki wypuklej punktow (k, log|c_k|) (wielokat Newtona, Bini 1996):
+    // odcinek od k_i do k_j daje k_j - k_i punktow na okregu o promieniu (|c_{k_i}| / |c_{k_j}|)^(1 / (k_j - k_i))
+    std::vector<Complex> initialApproximations(const std::vector<double>& c) {
+        const std::size_t n = c.size() - 1;
+        std::vector<std::size_t> hull;
+        auto logAbs = [&c](std::size_t k) { return std::log(std::abs(c[k])); };
+        for (std::size_t k = 0; k <= n; ++k) {
+            if (c[k] == 0.0) {
+                continue;
+            }
+            while (hull.size() >= 2) {
+                const std::size_t i = hull[hull.size() - 2], j = hull.back();
+                // j lezy nie wyzej niz odcinek i-k, wiec nie nalezy do gornej otoczki
+                const double cross = (static_cast<double>(j) - static_cast<double>(i)) * (logAbs(k) - logAbs(i)) -
+                                     (logAbs(j) - logAbs(i)) * (static_cast<double>(k) - static_cast<double>(i));
+                if (cross >= 0) {
+                    hull.pop_back();
+                } else {
+                    break;
+                }
+            }
+            hull.push_back(k);
+        }
+        const double pi = 3.14159265358979323846;
+        const double sigma = 0.7; // Obrot lamiacy symetrie wzgledem osi rzeczywistej
+        std::vector<Complex> z;
+        z.reserve(n);
+        for (std::size_t h = 0; h + 1 < hull.size(); ++h) {
+            const std::size_t i = hull[h], j = hull[h + 1];
+            const std::size_t m = j - i;
+            const double radius = std::exp((logAbs(i) - logAbs(j)) / static_cast<double>(m));
+            for (std::size_t q = 0; q < m; ++q) {
+                const double angle = 2.0 * pi * static_cast<double>(q) / static_cast<double>(m) +
+                                     2.0 * pi * static_cast<double>(i) / static_cast<double>(n) + sigma;
+                z.push_back(std::polar(radius, angle));
+            }
+        }
+        return z;
+    }
+
+    // Rownowazenie macierzy potegami 2 (jak EISPACK balanc): zmniejsza normy bez bledow zaokraglen
+    void balance(std::vector<std::vector<double>>& a) {
+        const std::size_t n = a.size();
+        const double radix = 2.0;
+        bool done = false;
+        while (!done) {
+            done = true;
+            for (std::size_t i = 0; i < n; ++i) {
+                double r = 0.0, c = 0.0;
+                for (std::size_t j = 0; j < n; ++j) {
+                    if (j != i) {
+                        c += std::abs(a[j][i]);
+                        r += std::abs(a[i][j]);
+                    }
+                }
+                if (c == 0.0 || r == 0.0) {
+                    continue;
+                }
+                double g = r / radix;
+                double f = 1.0;
+                const double s = c + r;
+                while (c < g) {
+                    f *= radix;
+                    c *= radix * radix;
+                }
+                g = r * radix;
+                while (c > g) {
+                    f /= radix;
+                    c /= radix * radix;
+                }
+                if ((c + r) / f < 0.95 * s) {
+                    done = false;
+                    g = 1.0 / f;
+                    for (std::size_t j = 0; j < n; ++j) {
+                        a[i][j] *= g;
+                    }
+                    for (std::size_t j = 0; j < n; ++j) {
+                        a[j][i] *= f;
+                    }
+                }
+            }
+        }
+    }
+
+    // Wartosci wlasne macierzy Hessenberga algorytmem QR z podwojnym przesunieciem Francisa (jak EISPACK hqr);
+    // false, jesli ktoras wartosc nie zbiegla w 60 iteracjach
+    bool hessenbergEigenvalues(std::vector<std::vector<double>> a, std::vector<Complex>& eigenvalues) {
+        const int n = static_cast<int>(a.size());
+        eigenvalues.assign(static_cast<std::size_t>(n), 0.0);
+        auto sign = [](double value, double of) { return of >= 0 ? std::abs(value) : -std::abs(value); };
+        double anorm = 0.0;
+        for (int i = 0; i < n; ++i) {
+            for (int j = std::max(i - 1, 0); j < n; ++j) {
+                anorm += std::abs(a[i][j]);
+            }
+        }
+        int nn = n - 1;
+        double t = 0.0;
+        while (nn >= 0) {
+            int its = 0;
+            int l;
+            do {
+                // Szukanie malego elementu pod przekatna, ktory rozdziela macierz
+                for (l = nn; l >= 1; --l) {
+                    double s = std::abs(a[l - 1][l - 1]) + std::abs(a[l][l]);
+                    if (s == 0.0) {
+                        s = anorm;
+                    }
+                    if (std::abs(a[l][l - 1]) + s == s) {
+                        a[l][l - 1] = 0.0;
+                        break;
+                    }
+                }
+                double x = a[nn][nn];
+                if (l == nn) {
+                    eigenvalues[nn--] = x + t;
+                } else {
+                    double y = a[nn - 1][nn - 1];
+                    double w = a[nn][nn - 1] * a[nn - 1][nn];
+                    if (l == nn - 1) {
+                        // Blok 2x2: para rzeczywista lub sprzezona
+                        const double p = 0.5 * (y - x);
+                        const double q = p * p + w;
+                        double z = std::sqrt(std::abs(q));
+                        x += t;
+                        if (q >= 0.0) {
+                            z = p + sign(z, p);
+                            eigenvalues[nn - 1] = eigenvalues[nn] = x + z;
+                            if (z != 0.0) {
+                                eigenvalues[nn] = x - w / z;
+                            }
+                        } else {
+                            eigenvalues[nn - 1] = Complex(x + p, -z);
+                            eigenvalues[nn] = Complex(x + p, z);
+                        }
+                        nn -= 2;
+                    } else {
+                        if (its == 60) {
+                            return false;
+                        }
+                        if (its == 10 || its == 20) {
+                            // Przesuniecie wyjatkowe
+                            t += x;
+                            for (int i = 0; i <= nn; ++i) {
+                                a[i][i] -= x;
+                            }
+                            const double s = std::abs(a[nn][nn - 1]) + std::abs(a[nn - 1][nn - 2]);
+                            y = x = 0.75 * s;
+                            w = -0.4375 * s * s;
+                        }
+                        ++its;
+                        int m;
+                        double p = 0.0, q = 0.0, r = 0.0, z;
+                        for (m = nn - 2; m >= l; --m) {
+                            z = a[m][m];
+                            r = x - z;
+                            double s = y - z;
+                            p = (r * s - w) / a[m + 1][m] + a[m][m + 1];
+                            q = a[m + 1][m + 1] - z - r - s;
+                            r = a[m + 2][m + 1];
+                            s = std::abs(p) + std::abs(q) + std::abs(r);
+                            p /= s;
+                            q /= s;
+                            r /= s;
+                            if (m == l) {
+                                break;
+                            }
+                            const double u = std::abs(a[m][m - 1]) * (std::abs(q) + std::abs(r));
+                            const double v = std::abs(p) * (std::abs(a[m - 1][m - 1]) + std::abs(z) + std::abs(a[m + 1][m + 1]));
+                            if (u + v == v) {
+                                break;
+                            }
+                        }
+                        for (int i = m; i < nn - 1; ++i) {
+                            a[i + 2][i] = 0.0;
+                            if (i != m) {
+                                a[i + 2][i - 1] = 0.0;
+                            }
+                        }
+                        // Krok QR z podwojnym przesunieciem na wierszach i kolumnach l..nn
+                        for (int k = m; k < nn; ++k) {
+                            if (k != m) {
+                                p = a[k][k - 1];
+                                q = a[k + 1][k - 1];
+                                r = k + 1 != nn ? a[k + 2][k - 1] : 0.0;
+                                x = std::abs(p) + std::abs(q) + std::abs(r);
+                                if (x != 0.0) {
+                                    p /= x;
+                                    q /= x;
+                                    r /= x;
+                                }
+                            }
+                            const double s = sign(std::sqrt(p * p + q * q + r * r), p);
+                            if (s == 0.0) {
+                                continue;
+                            }
+                            if (k == m) {
+                                if (l != m) {
+                                    a[k][k - 1] = -a[k][k - 1];
+                                }
+                            } else {
+                                a[k][k - 1] = -s * x;
+                            }
+                            p += s;
+                            x = p / s;
+                            y = q / s;
+                            z = r / s;
+                            q /= p;
+                            r /= p;
+                            for (int j = k; j <= nn; ++j) {
+                                p = a[k][j] + q * a[k + 1][j];
+                                if (k + 1 != nn) {
+                                    p += r * a[k + 2][j];
+                                    a[k + 2][j] -= p * z;
+                                }
+                                a[k + 1][j] -= p * y;
+                                a[k][j] -= p * x;
+                            }
+                            const int i_end = std::min(nn, k + 3);
+                            for (int i = l; i <= i_end; ++i) {
+                                p = x * a[i][k] + y * a[i][k + 1];
+                                if (k + 1 != nn) {
+                                    p += z * a[i][k + 2];
+                                    a[i][k + 2] -= p * r;
+                                }
+                                a[i][k + 1] -= p * q;
+                                a[i][k] -= p;
+                            }
+                        }
+                    }
+                }
+            } while (l < nn - 1);
+        }
+        return true;
+    }
+
+} // namespace
+
+PolynomialRoots polynomialRoots(const std::vector<double>& coefficients, const PolynomialRootOptions& options) {
+    if (options.epsilon <= 0 || options.max_iter <= 0) {
+        throw std::invalid_argument("Dokladnosc i maksymalna liczba iteracji musza byc dodatnie.");
+    }
+    if (options.threads <= 0) {
+        throw std::invalid_argument("Liczba watkow musi byc dodatnia.");
+    }
+    std::size_t high = coefficients.size();
+    while (high > 0 && coefficients[high - 1] == 0.0) {
+        --high;
+    }
+    if (high == 0) {
+        throw std::invalid_argument("Wielomian nie moze byc tozsamosciowo zerowy.");
+    }
+    std::size_t low = 0;
+    while (coefficients[low] == 0.0) {
+        ++low;
+    }
+
+    PolynomialRoots result;
+    result.converged = true;
+    // Czynnik x^low daje dokladne pierwiastki zerowe
+    result.roots.assign(low, Complex(0.0, 0.0));
+    const std::vector<double> c(coefficients.begin() + static_cast<std::ptrdiff_t>(low),
+                                coefficients.begin() + static_cast<std::ptrdiff_t>(high));
+    const std::size_t n = c.size() - 1;
+    auto sortRoots = [&result]() {
+        std::sort(result.roots.begin(), result.roots.end(), [](const Complex& u, const Complex& v) {
+            return u.real() < v.real() || (u.real() == v.real() && u.imag() < v.imag());
+        });
+    };
+    if (n == 0) {
+        sortRoots();
+        return result;
+    }
+
+    const double tolerance = std::max(options.epsilon, 4.0 * static_cast<double>(n) * std::numeric_limits<double>::epsilon());
+    std::vector<Complex> z = initialApproximations(c);
+    std::vector<Complex> z_next(n);
+    std::vector<unsigned char> active(n, 1);
+    std::size_t remaining = n;
+    const std::size_t block = 64;
+    const std::size_t blocks = (n + block - 1) / block;
+    std::vector<unsigned char> finished(n, 0);
+
+    // Iteracja Aberth-Ehrlicha w wersji Jacobiego: nowe przyblizenia liczone sa z poprzednich, wiec
+    // pierwiastki sa niezalezne i moga byc dzielone miedzy watki
+    while (remaining > 0 && result.iterations < options.max_iter) {
+        ++result.iterations;
+        parallel::parallelFor(blocks, options.threads, [&](std::size_t b, std::size_t) {
+            const std::size_t end = std::min(n, (b + 1) * block);
+            for (std::size_t i = b * block; i < end; ++i) {
+                z_next[i] = z[i];
+                if (!active[i]) {
+                    continue;
+                }
+                const HornerResult h = hornerRatio(c, z[i], tolerance);
+                if (h.small) {
+                    finished[i] = 1;
+                    continue;
+                }
+                Complex sum = 0.0;
+                for (std::size_t j = 0; j < n; ++j) {
+                    if (j != i) {
+                        sum += 1.0 / (z[i] - z[j]);
+                    }
+                }
+                const Complex correction = h.ratio / (1.0 - h.ratio * sum);
+                z_next[i] = z[i] - correction;
+                if (std::abs(correction) <= std::numeric_limits<double>::epsilon() * std::abs(z[i])) {
+                    finished[i] = 1;
+                }
+            }
+        });
+        z.swap(z_next);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (active[i] && finished[i]) {
+                active[i] = 0;
+                --remaining;
+            }
+        }
+    }
+
+    if (remaining > 0) {
+        // Wartosci wlasne macierzy stowarzyszonej (pierwszy wiersz -c_{n-1}/c_n ... -c_0/c_n, jedynki pod przekatna)
+        std::vector<std::vector<double>> companion(n, std::vector<double>(n, 0.0));
+        for (std::size_t j = 0; j < n; ++j) {
+            companion[0][j] = -c[n - 1 - j] / c[n];
+        }
+        for (std::size_t i = 1; i < n; ++i) {
+            companion[i][i - 1] = 1.0;
+        }
+        balance(companion);
+        result.used_companion = true;
+        result.converged = hessenbergEigenvalues(companion, z);
+    }
+
+    // Pierwiastki rzeczywiste z numerycznym szumem w czesci urojonej
+    for (Complex& root : z) {
+        if (root.imag() != 0.0 && hornerRatio(c, Complex(root.real(), 0.0), tolerance).small) {
+            root = Complex(root.real(), 0.0);
+        }
+    }
+    result.roots.insert(result.roots.end(), z.begin(), z.end());
+    sortRoots();
+    return result;
+}
+
+// === Uklady rownan nieliniowych ===
+
+namespace {
+
+    using Matrix = std::vector<std::vector<double>>;
+
+    double maxNorm(const std::vector<double>& v) {
+        double norm = 0.0;
+        for (double value : v) {
+            norm = std::max(norm, std::abs(value));
+        }
+        return norm;
+    }
+
+    double halfSquaredNorm(const std::vector<double>& v) {
+        double sum = 0.0;
+        for (double value : v) {
+            sum += value * value;
+        }
+        return 0.5 * sum;
+    }
+
+    // Jakobian uzytkownika lub roznice skonczone w przod (fx = F(x) musi byc juz policzone)
+    void evaluateSystemJacobian(const SystemFunction& F, const SystemSolverOptions& options,
+                                const std::vector<double>& x, const std::vector<double>& fx, Matrix& J,
+                                std::vector<double>& work_x, std::vector<double>& work_f, SystemRootResult& stats) {
+        ++stats.jacobian_evaluations;
+        if (options.jacobian) {
+            options.jacobian(x, J);
+            return;
+        }
+        const std::size_t n = x.size();
+        work_x = x;
+        for (std::size_t j = 0; j < n; ++j) {
+            double delta = std::sqrt(std::numeric_limits<double>::epsilon()) * std::max(1.0, std::abs(x[j]));
+            work_x[j] = x[j] + delta;
+            F(work_x, work_f);
+            ++stats.function_evaluations;
+            for (std::size_t i = 0; i < n; ++i) {
+                J[i][j] = (work_f[i] - fx[i]) / delta;
+            }
+            work_x[j] = x[j];
+        }
+    }
+
+} // namespace
+
+std::optional<SystemRootResult> solveSystem(const SystemFunction& F, const std::vector<double>& x0,
+                                            const SystemSolverOptions& options) {
+    if (!F) {
+        throw std::invalid_argument("Funkcja F nie moze byc pusta.");
+    }
+    if (x0.empty()) {
+        throw std::invalid_argument("Punkt startowy (x0) nie moze byc pusty.");
+    }
+    if (options.tolerance <= 0 || options.step_tolerance <= 0 || options.max_iter <= 0) {
+        throw std::invalid_argument("Tolerancje i maksymalna liczba iteracji musza byc dodatnie.");
+    }
+
+    const std::size_t n = x0.size();
+    const bool broyden = options.method == SystemMethod::Broyden;
+    SystemRootResult result;
+    std::vector<double> x = x0;
+    std::vector<double> fx(n);
+    F(x, fx);
+    result.function_evaluations = 1;
+
+    Matrix J(n, std::vector<double>(n, 0.0));
+    Matrix H; // Odwrotnosc jakobianu (tylko Broyden)
+    linear_algebra::LuFactorization lu;
+    std::vector<double> p(n), x_trial(n), f_trial(n), work_x(n), work_f(n), column(n), s(n), y(n), Hy(n), sH(n);
+    std::vector<double> unit(n, 0.0);
+    bool have_jacobian = false;
+    bool fresh_jacobian = false;
+
+    auto finish = [&]() {
+        result.root = x;
+        result.residual = maxNorm(fx);
+        return std::optional<SystemRootResult>(result);
+    };
+
+    // Nowy jakobian i jego rozklad; false, gdy macierz jest osobliwa
+    auto refreshJacobian = [&]() {
+        evaluateSystemJacobian(F, options, x, fx, J, work_x, work_f, result);
+        try {
+            lu = linear_algebra::luFactorize(J);
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+        ++result.factorizations;
+        if (broyden) {
+            H.assign(n, std::vector<double>(n, 0.0));
+            for (std::size_t j = 0; j < n; ++j) {
+                unit[j] = 1.0;
+                linear_algebra::luSolve(lu, unit, column);
+                unit[j] = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    H[i][j] = column[i];
+                }
+            }
+        }
+        have_jacobian = true;
+        fresh_jacobian = true;
+        return true;
+    };
+
+    while (result.iterations < options.max_iter) {
+        if (maxNorm(fx) < options.tolerance) {
+            return finish();
+        }
+        if (!have_jacobian || !broyden) {
+            if (!refreshJacobian()) {
+                return std::nullopt;
+            }
+        }
+        ++result.iterations;
+
+        // Kierunek: p = -J^{-1} F(x)
+        if (broyden) {
+            for (std::size_t i = 0; i < n; ++i) {
+                double sum = 0.0;
+                for (std::size_t j = 0; j < n; ++j) {
+                    sum += H[i][j] * fx[j];
+                }
+                p[i] = -sum;
+            }
+        } else {
+            linear_algebra::luSolve(lu, fx, p);
+            for (double& value : p) {
+                value = -value;
+            }
+        }
+
+        // Przeszukiwanie liniowe z interpolacja kwadratowa phi(lambda) = 0.5 ||F(x + lambda p)||^2;
+        // dla kierunku Newtona phi'(0) = -2 phi(0)
+        const double phi0 = halfSquaredNorm(fx);
+        double lambda = 1.0;
+        bool accepted = false;
+        while (true) {
+            for (std::size_t i = 0; i < n; ++i) {
+                x_trial[i] = x[i] + lambda * p[i];
+            }
+            F(x_trial, f_trial);
+            ++result.function_evaluations;
+            const double phi = halfSquaredNorm(f_trial);
+            if (std::isfinite(phi) && (!options.line_search || phi <= (1.0 - 2e-4 * lambda) * phi0)) {
+                accepted = true;
+                break;
+            }
+            if (!options.line_search || lambda < 1e-4) {
+                break;
+            }
+            double next = std::isfinite(phi) ? lambda * lambda * phi0 / (phi - phi0 + 2.0 * lambda * phi0) : 0.0;
+            lambda = std::min(std::max(next, 0.1 * lambda), 0.5 * lambda);
+        }
+        if (!accepted) {
+            if (broyden && !fresh_jacobian) {
+                have_jacobian = false; // Przyblizenie Broydena sie zdezaktualizowalo - restart z jakobianem
+                continue;
+            }
+            return std::nullopt;
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            s[i] = x_trial[i] - x[i];
+            y[i] = f_trial[i] - fx[i];
+        }
+        if (broyden) {
+            // Sherman-Morrison dla "dobrej" poprawki Broydena: H += (s - H y) (s^T H) / (s^T H y)
+            double denominator = 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+                double hy = 0.0, sh = 0.0;
+                for (std::size_t j = 0; j < n; ++j) {
+                    hy += H[i][j] * y[j];
+                    sh += s[j] * H[j][i];
+                }
+                Hy[i] = hy;
+                sH[i] = sh;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                denominator += s[i] * Hy[i];
+            }
+            if (std::abs(denominator) > std::numeric_limits<double>::epsilon() * maxNorm(s) * maxNorm(Hy)) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double factor = (s[i] - Hy[i]) / denominator;
+                    for (std::size_t j = 0; j < n; ++j) {
+                        H[i][j] += factor * sH[j];
+                    }
+                }
+            } else {
+                have_jacobian = false;
+            }
+            fresh_jacobian = false;
+        }
+        x.swap(x_trial);
+        fx.swap(f_trial);
+
+        if (maxNorm(s) < options.step_tolerance * (1.0 + maxNorm(x))) {
+            return finish();
+        }
+    }
+
+    if (maxNorm(fx) < options.tolerance) {
+        return finish();
+    }
+    return std::nullopt;
+}
 
 } // namespace nonlinear
 } // namespace numeric
\ No newline at end of file
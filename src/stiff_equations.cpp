@@ -0,0 +1,298 @@
+// src/stiff_equations.cpp
+
+#include "stiff_equations.h"
+#include "linear_algebra.h"
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+namespace numeric {
+namespace ode {
+
+namespace { // Anonimowa przestrzen nazw dla funkcji pomocniczych
+
+    using Matrix = std::vector<std::vector<double>>;
+
+    void validateStiffInputs(const OdeSystemFunction& f, const std::vector<double>& y0, double h, double x0, double x_end) {
+        if (!f) {
+            throw std::invalid_argument("Funkcja f nie jest zdefiniowana (jest pusta).");
+        }
+        if (y0.empty()) {
+            throw std::invalid_argument("Wektor stanu poczatkowego (y0) nie moze byc pusty.");
+        }
+        if (h <= 0) {
+            throw std::invalid_argument("Krok calkowania (h) musi byc dodatni.");
+        }
+        if (x_end < x0) {
+            throw std::invalid_argument("Punkt koncowy (x_end) nie moze byc mniejszy od punktu poczatkowego (x0).");
+        }
+    }
+
+    std::size_t stepCount(double x0, double h, double x_end) {
+        return static_cast<std::size_t>(std::floor((x_end - x0) / h + 1e-9));
+    }
+
+    // Jakobian uzytkownika lub roznice skonczone w przod (fx = f(x, y) musi byc juz policzone)
+    void evaluateJacobian(const OdeSystemFunction& f, const StiffOptions& options, double x, const std::vector<double>& y,
+                          const std::vector<double>& fx, Matrix& J, std::vector<double>& work_y,
+                          std::vector<double>& work_f, StiffSolution& stats) {
+        ++stats.jacobian_evaluations;
+        if (options.jacobian) {
+            options.jacobian(x, y, J);
+            return;
+        }
+        const std::size_t n = y.size();
+        work_y = y;
+        for (std::size_t j = 0; j < n; ++j) {
+            double delta = std::sqrt(std::numeric_limits<double>::epsilon()) * std::max(1.0, std::abs(y[j]));
+            work_y[j] = y[j] + delta;
+            f(x, work_y, work_f);
+            ++stats.rhs_evaluations;
+            for (std::size_t i = 0; i < n; ++i) {
+                J[i][j] = (work_f[i] - fx[i]) / delta;
+            }
+            work_y[j] = y[j];
+        }
+    }
+
+    // Rozklad macierzy I - c * J
+    linear_algebra::LuFactorization factorIterationMatrix(const Matrix& J, double c, StiffSolution& stats) {
+        const std::size_t n = J.size();
+        Matrix M(n, std::vector<double>(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                M[i][j] = (i == j ? 1.0 : 0.0) - c * J[i][j];
+            }
+        }
+        ++stats.factorizations;
+        return linear_algebra::luFactorize(std::move(M));
+    }
+
+    void appendPoint(SystemSolution& solution, double x, const std::vector<double>& y) {
+        solution.x.push_back(x);
+        solution.y.insert(solution.y.end(), y.begin(), y.end());
+    }
+
+    // Wspolczynniki BDF o stalym kroku: y_{n+1} = sum_j alpha[j] * y_{n-j} + h * beta * f(x_{n+1}, y_{n+1})
+    const double kBdfAlpha[5][5] = {
+        { 1.0 },
+        { 4.0 / 3.0, -1.0 / 3.0 },
+        { 18.0 / 11.0, -9.0 / 11.0, 2.0 / 11.0 },
+        { 48.0 / 25.0, -36.0 / 25.0, 16.0 / 25.0, -3.0 / 25.0 },
+        { 300.0 / 137.0, -300.0 / 137.0, 200.0 / 137.0, -75.0 / 137.0, 12.0 / 137.0 },
+    };
+    const double kBdfBeta[5] = { 1.0, 2.0 / 3.0, 6.0 / 11.0, 12.0 / 25.0, 60.0 / 137.0 };
+
+    // Norma maksimum roznicy wstecznej rzedu m z history[0..m] (history[j] to y_{n-j})
+    double backwardDifferenceNorm(const std::vector<std::vector<double>>& history, int m) {
+        double norm = 0.0;
+        for (std::size_t i = 0; i < history[0].size(); ++i) {
+            double sum = 0.0, binomial = 1.0;
+            for (int j = 0; j <= m; ++j) {
+                sum += ((j % 2 == 0) ? binomial : -binomial) * history[j][i];
+                binomial = binomial * (m - j) / (j + 1);
+            }
+            norm = std::max(norm, std::abs(sum));
+        }
+        return norm;
+    }
+
+    // Oszacowanie bledu lokalnego BDF rzedu q: beta_q / (q + 1) * |nabla^{q+1} y| (wymaga q + 2 punktow)
+    double bdfErrorEstimate(const std::vector<std::vector<double>>& history, int q) {
+        return kBdfBeta[q - 1] / (q + 1) * backwardDifferenceNorm(history, q + 1);
+    }
+
+} // Koniec anonimowej przestrzeni nazw
+
+std::optional<StiffSolution> bdfSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                       double h, double x_end, int max_order, const StiffOptions& options) {
+    validateStiffInputs(f, y0, h, x0, x_end);
+    if (max_order < 1 || max_order > 5) {
+        throw std::invalid_argument("Rzad metody BDF musi nalezec do przedzialu [1, 5].");
+    }
+    if (options.newton_tol <= 0 || options.max_newton_iter <= 0) {
+        throw std::invalid_argument("Nieprawidlowe parametry iteracji Newtona.");
+    }
+
+    const std::size_t n = y0.size();
+    const std::size_t steps = stepCount(x0, h, x_end);
+    StiffSolution result;
+    result.trajectory.dimension = n;
+    result.trajectory.x.reserve(steps + 1);
+    result.trajectory.y.reserve((steps + 1) * n);
+    appendPoint(result.trajectory, x0, y0);
+
+    // history[j] to y_{n-j} (available z nich jest juz policzonych); wszystkie bufory alokowane raz.
+    // Dwa dodatkowe punkty sluza do oszacowania bledu rzedow order i order + 1.
+    std::vector<std::vector<double>> history(max_order + 2, y0);
+    int available = 1;
+    int order = 1;
+    int steps_at_order = 0;
+    result.orders.reserve(steps);
+    std::vector<double> y(n), psi(n), fy(n), residual(n), delta(n), work_y(n), work_f(n);
+    Matrix J(n, std::vector<double>(n, 0.0));
+    linear_algebra::LuFactorization lu;
+    bool have_jacobian = false;
+    double factored_beta = -1.0;
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        const double x_prev = x0 + static_cast<double>(step) * h;
+        const double x = x0 + static_cast<double>(step + 1) * h;
+        const double* alpha = kBdfAlpha[order - 1];
+        const double beta = kBdfBeta[order - 1];
+
+        std::fill(psi.begin(), psi.end(), 0.0);
+        for (int j = 0; j < order; ++j) {
+            for (std::size_t i = 0; i < n; ++i) {
+                psi[i] += alpha[j] * history[j][i];
+            }
+        }
+
+        bool converged = false;
+        bool fresh_jacobian = false;
+        while (!converged) {
+            if (!have_jacobian) {
+                f(x_prev, history[0], fy);
+                ++result.rhs_evaluations;
+                evaluateJacobian(f, options, x_prev, history[0], fy, J, work_y, work_f, result);
+                have_jacobian = true;
+                fresh_jacobian = true;
+                factored_beta = -1.0;
+            }
+            if (factored_beta != beta) {
+                try {
+                    lu = factorIterationMatrix(J, h * beta, result);
+                } catch (const std::runtime_error&) {
+                    return std::nullopt; // Osobliwa macierz iteracji
+                }
+                factored_beta = beta;
+            }
+
+            // Predyktor: ekstrapolacja liniowa z dwoch ostatnich punktow
+            for (std::size_t i = 0; i < n; ++i) {
+                y[i] = (available > 1) ? 2.0 * history[0][i] - history[1][i] : history[0][i];
+            }
+
+            double previous_norm = std::numeric_limits<double>::infinity();
+            for (int iter = 0; iter < options.max_newton_iter; ++iter) {
+                f(x, y, fy);
+                ++result.rhs_evaluations;
+                for (std::size_t i = 0; i < n; ++i) {
+                    residual[i] = y[i] - h * beta * fy[i] - psi[i];
+                }
+                linear_algebra::luSolve(lu, residual, delta);
+                double norm = 0.0, scale = 1.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    y[i] -= delta[i];
+                    norm = std::max(norm, std::abs(delta[i]));
+                    scale = std::max(scale, std::abs(y[i]));
+                }
+                if (norm <= options.newton_tol * scale) {
+                    converged = true;
+                    break;
+                }
+                // Iteracja rozbiega sie - macierz jest zbyt nieaktualna
+                if (norm > 2.0 * previous_norm) {
+                    break;
+                }
+                previous_norm = norm;
+            }
+
+            if (!converged) {
+                if (fresh_jacobian) {
+                    return std::nullopt;
+                }
+                have_jacobian = false; // Odswiezenie jakobianu i ponowna proba kroku
+            }
+        }
+
+        std::rotate(history.rbegin(), history.rbegin() + 1, history.rend());
+        std::swap(history[0], y);
+        appendPoint(result.trajectory, x, history[0]);
+        result.orders.push_back(order);
+        available = std::min<int>(available + 1, max_order + 2);
+        ++steps_at_order;
+
+        // Wybor rzedu przy stalym h: rzad o najmniejszym oszacowaniu bledu sposrod order - 1, order, order + 1.
+        // Zmiana wymaga order krokow bez zmiany, co ogranicza liczbe ponownych rozkladow macierzy iteracji.
+        if (steps_at_order < order || available < order + 2) {
+            continue;
+        }
+        const double error_current = bdfErrorEstimate(history, order);
+        int new_order = order;
+        double best = error_current;
+        if (order > 1) {
+            const double error_lower = bdfErrorEstimate(history, order - 1);
+            if (error_lower <= best) {
+                new_order = order - 1;
+                best = error_lower;
+            }
+        }
+        if (order < max_order && available >= order + 3) {
+            const double error_higher = bdfErrorEstimate(history, order + 1);
+            if (error_higher < best) {
+                new_order = order + 1;
+            }
+        }
+        if (new_order != order) {
+            order = new_order;
+            steps_at_order = 0;
+        }
+    }
+    return result;
+}
+
+std::optional<StiffSolution> rosenbrockSystem(const OdeSystemFunction& f, double x0, const std::vector<double>& y0,
+                                              double h, double x_end, const StiffOptions& options) {
+    validateStiffInputs(f, y0, h, x0, x_end);
+    if (options.jacobian_reuse <= 0) {
+        throw std::invalid_argument("Liczba krokow z tym samym jakobianem musi byc dodatnia.");
+    }
+
+    // ROS2 (Verwer i in.): gamma = 1 + 1/sqrt(2)
+    const double gamma = 1.0 + 1.0 / std::sqrt(2.0);
+    const std::size_t n = y0.size();
+    const std::size_t steps = stepCount(x0, h, x_end);
+    StiffSolution result;
+    result.trajectory.dimension = n;
+    result.trajectory.x.reserve(steps + 1);
+    result.trajectory.y.reserve((steps + 1) * n);
+    appendPoint(result.trajectory, x0, y0);
+
+    std::vector<double> y = y0, rhs(n), k1(n), k2(n), tmp(n), work_y(n), work_f(n);
+    Matrix J(n, std::vector<double>(n, 0.0));
+    linear_algebra::LuFactorization W;
+
+    for (std::size_t step = 0; step < steps; ++step) {
+        const double x = x0 + static_cast<double>(step) * h;
+        f(x, y, rhs);
+        ++result.rhs_evaluations;
+        if (step % static_cast<std::size_t>(options.jacobian_reuse) == 0) {
+            evaluateJacobian(f, options, x, y, rhs, J, work_y, work_f, result);
+            try {
+                W = factorIterationMatrix(J, gamma * h, result);
+            } catch (const std::runtime_error&) {
+                return std::nullopt;
+            }
+        }
+
+        linear_algebra::luSolve(W, rhs, k1);
+        for (std::size_t i = 0; i < n; ++i) {
+            tmp[i] = y[i] + h * k1[i];
+        }
+        f(x + h, tmp, rhs);
+        ++result.rhs_evaluations;
+        for (std::size_t i = 0; i < n; ++i) {
+            rhs[i] -= 2.0 * k1[i];
+        }
+        linear_algebra::luSolve(W, rhs, k2);
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] += h * (1.5 * k1[i] + 0.5 * k2[i]);
+        }
+        appendPoint(result.trajectory, x0 + static_cast<double>(step + 1) * h, y);
+    }
+    return result;
+}
+
+} // namespace ode
+} // namespace numeric
@@ -0,0 +1,418 @@
+// src/trajectory_io.cpp
+
+#include "trajectory_io.h"
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace numeric {
+namespace ode {
+
+namespace { // Anonimowa przestrzen nazw dla funkcji pomocniczych
+    const char kHeaderMagic[8] = { 'N', 'U', 'M', 'C', 'P', 'P', 'T', 'R' };
+    const char kFooterMagic[8] = { 'N', 'U', 'M', 'C', 'P', 'P', 'E', 'N' };
+    const std::uint32_t kByteOrderMark = 0x01020304u;
+    const std::uint32_t kFormatVersion = 1;
+    const std::size_t kHeaderSize = 64;
+    const std::size_t kIndexEntrySize = 32;
+    const std::size_t kFooterSize = 24;
+
+    template <typename T>
+    T readRaw(const unsigned char* p) {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void storeRaw(unsigned char* p, T value) {
+        std::memcpy(p, &value, sizeof(T));
+    }
+} // Koniec anonimowej przestrzeni nazw
+
+// === TrajectoryWriter ===
+
+TrajectoryWriter::TrajectoryWriter(std::ostream& out, std::size_t dimension, StoragePrecision precision,
+                                   std::size_t chunk_rows)
+    : out_(out), dimension_(dimension), element_size_(precision == StoragePrecision::Float32 ? 4 : 8),
+      chunk_rows_(chunk_rows) {
+    if (dimension == 0 || chunk_rows == 0) {
+        throw std::invalid_argument("Wymiar stanu i liczba wierszy w porcji musza byc dodatnie.");
+    }
+    x_buffer_.resize(chunk_rows_);
+    y_buffer_.resize(dimension_ * chunk_rows_);
+    if (element_size_ == 4) {
+        float_buffer_.resize(chunk_rows_);
+    }
+
+    unsigned char header[kHeaderSize] = {};
+    std::memcpy(header, kHeaderMagic, 8);
+    storeRaw<std::uint32_t>(header + 8, kByteOrderMark);
+    storeRaw<std::uint32_t>(header + 12, kFormatVersion);
+    storeRaw<std::uint64_t>(header + 16, dimension_);
+    storeRaw<std::uint32_t>(header + 24, static_cast<std::uint32_t>(element_size_));
+    storeRaw<std::uint64_t>(header + 32, chunk_rows_);
+    writeBytes(header, kHeaderSize);
+}
+
+TrajectoryWriter::~TrajectoryWriter() {
+    try {
+        finish();
+    } catch (...) {
+        // Destruktor nie moze rzucac; bledy zapisu zglasza jawne wywolanie finish()
+    }
+}
+
+void TrajectoryWriter::writeBytes(const void* data, std::size_t size) {
+    out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    if (!out_) {
+        failed_ = true; // Stan buforow i indeksu jest niespojny z zawartoscia strumienia
+        throw std::runtime_error("Blad zapisu trajektorii do strumienia.");
+    }
+    offset_ += size;
+}
+
+void TrajectoryWriter::writeColumn(const double* values, std::size_t count) {
+    if (element_size_ == 8) {
+        writeBytes(values, count * sizeof(double));
+    } else {
+        std::transform(values, values + count, float_buffer_.begin(), [](double v) { return static_cast<float>(v); });
+        writeBytes(float_buffer_.data(), count * sizeof(float));
+    }
+}
+
+void TrajectoryWriter::flushChunk() {
+    if (buffered_ == 0) {
+        return;
+    }
+    const std::uint64_t chunk_offset = offset_;
+    writeBytes(x_buffer_.data(), buffered_ * sizeof(double)); // x zawsze w pelnej precyzji
+    for (std::size_t k = 0; k < dimension_; ++k) {
+        writeColumn(y_buffer_.data() + k * chunk_rows_, buffered_);
+    }
+    // Wyrownanie do 8 B, zeby kolumna x nastepnej porcji (i indeks) byly wyrownane dla double
+    if (offset_ % sizeof(double) != 0) {
+        const unsigned char padding[sizeof(double)] = {};
+        writeBytes(padding, sizeof(double) - offset_ % sizeof(double));
+    }
+    // Wpis indeksu dopiero po zapisaniu calej porcji
+    index_.push_back({ chunk_offset, buffered_, x_buffer_[0], x_buffer_[buffered_ - 1] });
+    buffered_ = 0;
+}
+
+void TrajectoryWriter::append(double x, const double* y) {
+    if (failed_) {
+        throw std::logic_error("Nie mozna dopisywac do trajektorii po bledzie zapisu.");
+    }
+    if (finished_) {
+        throw std::logic_error("Nie mozna dopisywac do zamknietej trajektorii.");
+    }
+    x_buffer_[buffered_] = x;
+    for (std::size_t k = 0; k < dimension_; ++k) {
+        y_buffer_[k * chunk_rows_ + buffered_] = y[k];
+    }
+    ++buffered_;
+    ++total_rows_;
+    if (buffered_ == chunk_rows_) {
+        flushChunk();
+    }
+}
+
+void TrajectoryWriter::append(double x, const std::vector<double>& y) {
+    if (y.size() != dimension_) {
+        throw std::invalid_argument("Rozmiar stanu nie zgadza sie z wymiarem trajektorii.");
+    }
+    append(x, y.data());
+}
+
+void TrajectoryWriter::finish() {
+    if (failed_) {
+        throw std::logic_error("Nie mozna zamknac trajektorii po bledzie zapisu.");
+    }
+    if (finished_) {
+        return;
+    }
+    finished_ = true;
+    flushChunk();
+    const std::uint64_t index_offset = offset_;
+    unsigned char entry[kIndexEntrySize];
+    for (const IndexEntry& e : index_) {
+        storeRaw<std::uint64_t>(entry, e.offset);
+        storeRaw<std::uint64_t>(entry + 8, e.rows);
+        storeRaw<double>(entry + 16, e.x_first);
+        storeRaw<double>(entry + 24, e.x_last);
+        writeBytes(entry, kIndexEntrySize);
+    }
+    unsigned char footer[kFooterSize];
+    storeRaw<std::uint64_t>(footer, index_offset);
+    storeRaw<std::uint64_t>(footer + 8, index_.size());
+    std::memcpy(footer + 16, kFooterMagic, 8);
+    writeBytes(footer, kFooterSize);
+    out_.flush();
+}
+
+SystemObserver TrajectoryWriter::observer() {
+    return [this](double x, const std::vector<double>& y) { append(x, y); };
+}
+
+Observer TrajectoryWriter::scalarObserver() {
+    if (dimension_ != 1) {
+        throw std::invalid_argument("Obserwator skalarny wymaga trajektorii o wymiarze 1.");
+    }
+    return [this](double x, double y) { append(x, &y); };
+}
+
+// === TrajectoryReader ===
+
+TrajectoryReader::TrajectoryReader(const std::string& path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Nie mozna otworzyc pliku trajektorii: " + path);
+    }
+    file_handle_ = file;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        release();
+        throw std::runtime_error("Nie mozna odczytac rozmiaru pliku trajektorii: " + path);
+    }
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        release();
+        throw std::runtime_error("Nie mozna zmapowac pliku trajektorii: " + path);
+    }
+    mapping_handle_ = mapping;
+    data_ = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr) {
+        release();
+        throw std::runtime_error("Nie mozna zmapowac pliku trajektorii: " + path);
+    }
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Nie mozna otworzyc pliku trajektorii: " + path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error("Nie mozna odczytac rozmiaru pliku trajektorii: " + path);
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // Mapowanie pozostaje wazne po zamknieciu deskryptora
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("Nie mozna zmapowac pliku trajektorii: " + path);
+    }
+    data_ = static_cast<const unsigned char*>(mapped);
+#endif
+
+    // Walidacja naglowka, stopki i indeksu
+    if (size_ < kHeaderSize + kFooterSize || std::memcmp(data_, kHeaderMagic, 8) != 0 ||
+        std::memcmp(data_ + size_ - 8, kFooterMagic, 8) != 0) {
+        release();
+        throw std::runtime_error("Plik nie jest kompletna trajektoria w formacie kolumnowym: " + path);
+    }
+    if (readRaw<std::uint32_t>(data_ + 8) != kByteOrderMark || readRaw<std::uint32_t>(data_ + 12) != kFormatVersion) {
+        release();
+        throw std::runtime_error("Nieobslugiwany porzadek bajtow lub wersja pliku trajektorii: " + path);
+    }
+    dimension_ = static_cast<std::size_t>(readRaw<std::uint64_t>(data_ + 16));
+    element_size_ = readRaw<std::uint32_t>(data_ + 24);
+    chunk_capacity_ = static_cast<std::size_t>(readRaw<std::uint64_t>(data_ + 32));
+    const std::uint64_t index_offset = readRaw<std::uint64_t>(data_ + size_ - kFooterSize);
+    chunk_count_ = static_cast<std::size_t>(readRaw<std::uint64_t>(data_ + size_ - kFooterSize + 8));
+    // Kazdy czynnik jest ograniczony rozmiarem pliku przed mnozeniem, wiec uszkodzone wartosci nie moga
+    // przepelnic arytmetyki i przejsc kontroli
+    if (dimension_ == 0 || (element_size_ != 4 && element_size_ != 8) || chunk_capacity_ == 0 ||
+        dimension_ >= size_ / element_size_ || chunk_count_ > (size_ - kFooterSize) / kIndexEntrySize ||
+        index_offset < kHeaderSize || index_offset > size_ - kFooterSize ||
+        size_ - kFooterSize - index_offset != chunk_count_ * kIndexEntrySize) {
+        release();
+        throw std::runtime_error("Uszkodzony naglowek lub indeks pliku trajektorii: " + path);
+    }
+    const std::uint64_t row_bytes = sizeof(double) + dimension_ * element_size_;
+    index_ = data_ + index_offset;
+    for (std::size_t c = 0; c < chunk_count_; ++c) {
+        const std::uint64_t offset = readRaw<std::uint64_t>(index_ + c * kIndexEntrySize);
+        const std::uint64_t rows = readRaw<std::uint64_t>(index_ + c * kIndexEntrySize + 8);
+        if (rows == 0 || rows > chunk_capacity_ || (rows < chunk_capacity_ && c + 1 != chunk_count_) ||
+            offset < kHeaderSize || offset > index_offset || offset % sizeof(double) != 0 ||
+            rows > (index_offset - offset) / row_bytes) {
+            release();
+            throw std::runtime_error("Uszkodzony indeks pliku trajektorii: " + path);
+        }
+        rows_ += static_cast<std::size_t>(rows);
+    }
+}
+
+TrajectoryReader::~TrajectoryReader() {
+    release();
+}
+
+TrajectoryReader::TrajectoryReader(TrajectoryReader&& other) noexcept {
+    *this = std::move(other);
+}
+
+TrajectoryReader& TrajectoryReader::operator=(TrajectoryReader&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        file_handle_ = std::exchange(other.file_handle_, nullptr);
+        mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+        dimension_ = other.dimension_;
+        element_size_ = other.element_size_;
+        chunk_capacity_ = other.chunk_capacity_;
+        chunk_count_ = std::exchange(other.chunk_count_, 0);
+        rows_ = std::exchange(other.rows_, 0);
+        index_ = std::exchange(other.index_, nullptr);
+    }
+    return *this;
+}
+
+void TrajectoryReader::release() noexcept {
+#ifdef _WIN32
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    }
+    if (file_handle_) {
+        CloseHandle(static_cast<HANDLE>(file_handle_));
+    }
+#else
+    if (data_) {
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    file_handle_ = nullptr;
+    mapping_handle_ = nullptr;
+    size_ = 0;
+}
+
+std::size_t TrajectoryReader::chunkRows(std::size_t chunk) const {
+    if (chunk >= chunk_count_) {
+        throw std::invalid_argument("Indeks porcji poza zakresem.");
+    }
+    return static_cast<std::size_t>(readRaw<std::uint64_t>(index_ + chunk * kIndexEntrySize + 8));
+}
+
+double TrajectoryReader::chunkFirstX(std::size_t chunk) const {
+    if (chunk >= chunk_count_) {
+        throw std::invalid_argument("Indeks porcji poza zakresem.");
+    }
+    return readRaw<double>(index_ + chunk * kIndexEntrySize + 16);
+}
+
+double TrajectoryReader::chunkLastX(std::size_t chunk) const {
+    if (chunk >= chunk_count_) {
+        throw std::invalid_argument("Indeks porcji poza zakresem.");
+    }
+    return readRaw<double>(index_ + chunk * kIndexEntrySize + 24);
+}
+
+std::size_t TrajectoryReader::findChunk(double x) const {
+    if (chunk_count_ == 0 || x < chunkFirstX(0) || x > chunkLastX(chunk_count_ - 1)) {
+        throw std::invalid_argument("Punkt x lezy poza zakresem trajektorii.");
+    }
+    // Ostatnia porcja, ktorej pierwszy x jest <= x
+    std::size_t lo = 0, hi = chunk_count_ - 1;
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo + 1) / 2;
+        if (chunkFirstX(mid) <= x) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+const void* TrajectoryReader::column(std::size_t chunk, std::size_t column, std::size_t element_size) const {
+    if (element_size != (column == 0 ? sizeof(double) : element_size_)) {
+        throw std::invalid_argument("Typ kolumny nie odpowiada precyzji zapisu trajektorii.");
+    }
+    if (column > dimension_) {
+        throw std::invalid_argument("Indeks skladowej poza zakresem.");
+    }
+    const std::size_t rows = chunkRows(chunk);
+    const std::uint64_t offset = readRaw<std::uint64_t>(index_ + chunk * kIndexEntrySize);
+    if (column == 0) {
+        return data_ + offset;
+    }
+    return data_ + offset + rows * sizeof(double) + (column - 1) * rows * element_size_;
+}
+
+double TrajectoryReader::value(std::size_t row, std::size_t column) const {
+    if (row >= rows_) {
+        throw std::invalid_argument("Indeks wiersza poza zakresem.");
+    }
+    const std::size_t chunk = row / chunk_capacity_;
+    const std::size_t local = row % chunk_capacity_;
+    const std::size_t element_size = (column == 0) ? sizeof(double) : element_size_;
+    const void* data = this->column(chunk, column, element_size);
+    if (element_size == 4) {
+        return static_cast<double>(readRaw<float>(static_cast<const unsigned char*>(data) + local * 4));
+    }
+    return readRaw<double>(static_cast<const unsigned char*>(data) + local * 8);
+}
+
+double TrajectoryReader::x(std::size_t row) const {
+    return value(row, 0);
+}
+
+double TrajectoryReader::state(std::size_t row, std::size_t component) const {
+    if (component >= dimension_) {
+        throw std::invalid_argument("Indeks skladowej poza zakresem.");
+    }
+    return value(row, component + 1);
+}
+
+std::vector<double> TrajectoryReader::xValues() const {
+    std::vector<double> result;
+    result.reserve(rows_);
+    for (std::size_t c = 0; c < chunk_count_; ++c) {
+        const double* column = xColumn<double>(c);
+        result.insert(result.end(), column, column + chunkRows(c));
+    }
+    return result;
+}
+
+std::vector<double> TrajectoryReader::component(std::size_t component) const {
+    if (component >= dimension_) {
+        throw std::invalid_argument("Indeks skladowej poza zakresem.");
+    }
+    std::vector<double> result;
+    result.reserve(rows_);
+    for (std::size_t c = 0; c < chunk_count_; ++c) {
+        const std::size_t rows = chunkRows(c);
+        if (element_size_ == 8) {
+            const double* column = stateColumn<double>(c, component);
+            result.insert(result.end(), column, column + rows);
+        } else {
+            const float* column = stateColumn<float>(c, component);
+            result.insert(result.end(), column, column + rows);
+        }
+    }
+    return result;
+}
+
+} // namespace ode
+} // namespace numeric
@@ -7,6 +7,9 @@ void TestGaussEliminationSolvable();
 void TestGaussEliminationThrowsOnInvalidInput();
 void TestLuDecompositionSolvable();
 void TestLuDecompositionThrowsOnInvalidInput();
+void TestLuFactorizeReuse();
+void TestBandedLuCorrectness();
+void TestBandedLuThrowsOnInvalidInput();
 
 // === Deklaracje testow dla: interpolation ===
 void TestLagrangeInterpolationCorrectness();
@@ -25,6 +28,18 @@ void TestGaussLegendreCorrectness();
 void TestGaussLegendreThrowsOnUnsupportedNodes();
 void TestSegmentedGaussLegendreCorrectness();
 void TestSegmentedGaussLegendreThrowsOnInvalidInput();
+void TestRombergIntegrationCorrectness();
+void TestRombergIntegrationThrowsOnInvalidInput();
+void TestBatchRulesMatchScalarRules();
+void TestBatchRulesThrowOnInvalidInput();
+void TestStreamingIntegratorCorrectness();
+void TestStreamingIntegratorThrowsOnInvalidInput();
+void TestDoubleExponentialIntegrationCorrectness();
+void TestDoubleExponentialIntegrationThrowsOnInvalidInput();
+void TestGaussLaguerreHermiteCorrectness();
+void TestGaussLaguerreHermiteThrowsOnInvalidInput();
+void TestVectorIntegrationCorrectness();
+void TestVectorIntegrationThrowsOnInvalidInput();
 
 // === Deklaracje testow dla: differential_equations ===
 void TestEulerMethodCorrectness();
@@ -35,6 +50,36 @@ void TestMidpointMethodCorrectness();
 void TestMidpointMethodThrowsOnInvalidInput();
 void TestRungeKutta4Correctness();
 void TestRungeKutta4ThrowsOnInvalidInput();
+void TestSystemMethodsCorrectness();
+void TestSystemMethodsThrowOnInvalidInput();
+void TestAdaptiveMethodsCorrectness();
+void TestAdaptiveMethodsThrowOnInvalidInput();
+void TestObserversCorrectness();
+void TestObserversThrowOnInvalidInput();
+void TestEnsembleCorrectness();
+void TestEnsembleThrowsOnInvalidInput();
+void TestRungeKuttaEngineCorrectness();
+void TestRungeKuttaEngineThrowsOnInvalidInput();
+void TestAdamsBashforthMoultonCorrectness();
+void TestAdamsBashforthMoultonThrowsOnInvalidInput();
+void TestEventsCorrectness();
+void TestEventsThrowOnInvalidInput();
+void TestPararealCorrectness();
+void TestPararealThrowsOnInvalidInput();
+
+// === Deklaracje testow dla: stiff_equations ===
+void TestBdfSystemCorrectness();
+void TestBdfSystemThrowsOnInvalidInput();
+void TestRosenbrockSystemCorrectness();
+void TestRosenbrockSystemThrowsOnInvalidInput();
+
+// === Deklaracje testow dla: trajectory_io ===
+void TestTrajectoryIoRoundTrip();
+void TestTrajectoryIoThrowsOnInvalidInput();
+
+// === Deklaracje testow dla: method_of_lines ===
+void TestMethodOfLinesCorrectness();
+void TestMethodOfLinesThrowsOnInvalidInput();
 
 // === Deklaracje testow dla: nonlinear_equations ===
 void TestBisectionMethodFindsRoot();
@@ -45,11 +90,35 @@ void TestNewtonMethodAnalyticalFindsRoot();
 void TestNewtonMethodNumericalFindsRoot();
 void TestRegulaFalsiMethodFindsRoot();
 void TestRegulaFalsiMethodReturnsNullopt();
+void TestHybridRootFindersCorrectness();
+void TestHybridRootFindersThrowOnInvalidInput();
+void TestMultisectionMethodCorrectness();
+void TestMultisectionMethodThrowsOnInvalidInput();
+void TestBatchRootFindersCorrectness();
+void TestBatchRootFindersThrowOnInvalidInput();
+void TestFindAllRootsCorrectness();
+void TestFindAllRootsThrowsOnInvalidInput();
+void TestPolynomialRootsCorrectness();
+void TestPolynomialRootsThrowsOnInvalidInput();
+void TestSolveSystemCorrectness();
+void TestSolveSystemThrowsOnInvalidInput();
+
+// === Deklaracje testow dla: autodiff ===
+void TestAutodiffCorrectness();
+void TestAutodiffThrowsOnInvalidInput();
 
 // === Deklaracje testow dla: approximation ===
 void TestApproximateValueAtPointCorrectness();
 void TestApproximateValueAtPointThrowsOnInvalidInput();
 
+// === Deklaracje testow dla: cubature ===
+void TestTensorGaussLegendreCorrectness();
+void TestTensorGaussLegendreThrowsOnInvalidInput();
+void TestSparseGridIntegrationCorrectness();
+void TestSparseGridIntegrationThrowsOnInvalidInput();
+void TestSobolQuasiMonteCarloCorrectness();
+void TestSobolQuasiMonteCarloThrowsOnInvalidInput();
+
 int main() {
     std::cout << "=== URUCHAMIANIE TESTOW JEDNOSTKOKWYCH BIBLIOTEKI NumCppLib ===\n" << std::endl;
 
@@ -58,6 +127,9 @@ int main() {
     TestGaussEliminationThrowsOnInvalidInput();
     TestLuDecompositionSolvable();
     TestLuDecompositionThrowsOnInvalidInput();
+    TestLuFactorizeReuse();
+    TestBandedLuCorrectness();
+    TestBandedLuThrowsOnInvalidInput();
 
     std::cout << "\n--- Modul: Interpolation ---" << std::endl;
     TestLagrangeInterpolationCorrectness();
@@ -76,6 +148,18 @@ int main() {
     TestGaussLegendreThrowsOnUnsupportedNodes();
     TestSegmentedGaussLegendreCorrectness();
     TestSegmentedGaussLegendreThrowsOnInvalidInput(); 
+    TestRombergIntegrationCorrectness();
+    TestRombergIntegrationThrowsOnInvalidInput();
+    TestBatchRulesMatchScalarRules();
+    TestBatchRulesThrowOnInvalidInput();
+    TestStreamingIntegratorCorrectness();
+    TestStreamingIntegratorThrowsOnInvalidInput();
+    TestDoubleExponentialIntegrationCorrectness();
+    TestDoubleExponentialIntegrationThrowsOnInvalidInput();
+    TestGaussLaguerreHermiteCorrectness();
+    TestGaussLaguerreHermiteThrowsOnInvalidInput();
+    TestVectorIntegrationCorrectness();
+    TestVectorIntegrationThrowsOnInvalidInput();
     
     std::cout << "\n--- Modul: Differential Equations ---" << std::endl;
     TestEulerMethodCorrectness();
@@ -86,6 +170,36 @@ int main() {
     TestMidpointMethodThrowsOnInvalidInput();
     TestRungeKutta4Correctness();
     TestRungeKutta4ThrowsOnInvalidInput();
+    TestSystemMethodsCorrectness();
+    TestSystemMethodsThrowOnInvalidInput();
+    TestAdaptiveMethodsCorrectness();
+    TestAdaptiveMethodsThrowOnInvalidInput();
+    TestObserversCorrectness();
+    TestObserversThrowOnInvalidInput();
+    TestEnsembleCorrectness();
+    TestEnsembleThrowsOnInvalidInput();
+    TestRungeKuttaEngineCorrectness();
+    TestRungeKuttaEngineThrowsOnInvalidInput();
+    TestAdamsBashforthMoultonCorrectness();
+    TestAdamsBashforthMoultonThrowsOnInvalidInput();
+    TestEventsCorrectness();
+    TestEventsThrowOnInvalidInput();
+    TestPararealCorrectness();
+    TestPararealThrowsOnInvalidInput();
+
+    std::cout << "\n--- Modul: Stiff Equations ---" << std::endl;
+    TestBdfSystemCorrectness();
+    TestBdfSystemThrowsOnInvalidInput();
+    TestRosenbrockSystemCorrectness();
+    TestRosenbrockSystemThrowsOnInvalidInput();
+
+    std::cout << "\n--- Modul: Trajectory IO ---" << std::endl;
+    TestTrajectoryIoRoundTrip();
+    TestTrajectoryIoThrowsOnInvalidInput();
+
+    std::cout << "\n--- Modul: Method of Lines ---" << std::endl;
+    TestMethodOfLinesCorrectness();
+    TestMethodOfLinesThrowsOnInvalidInput();
 
     std::cout << "\n--- Modul: Nonlinear Equations ---" << std::endl;
     TestBisectionMethodFindsRoot();
@@ -96,11 +210,35 @@ int main() {
     TestNewtonMethodNumericalFindsRoot();
     TestRegulaFalsiMethodFindsRoot();
     TestRegulaFalsiMethodReturnsNullopt();
+    TestHybridRootFindersCorrectness();
+    TestHybridRootFindersThrowOnInvalidInput();
+    TestMultisectionMethodCorrectness();
+    TestMultisectionMethodThrowsOnInvalidInput();
+    TestBatchRootFindersCorrectness();
+    TestBatchRootFindersThrowOnInvalidInput();
+    TestFindAllRootsCorrectness();
+    TestFindAllRootsThrowsOnInvalidInput();
+    TestPolynomialRootsCorrectness();
+    TestPolynomialRootsThrowsOnInvalidInput();
+    TestSolveSystemCorrectness();
+    TestSolveSystemThrowsOnInvalidInput();
     
+    std::cout << "\n--- Modul: Autodiff ---" << std::endl;
+    TestAutodiffCorrectness();
+    TestAutodiffThrowsOnInvalidInput();
+
     std::cout << "\n--- Modul: Approximation ---" << std::endl;
     TestApproximateValueAtPointCorrectness();
     TestApproximateValueAtPointThrowsOnInvalidInput();
 
+    std::cout << "\n--- Modul: Cubature ---" << std::endl;
+    TestTensorGaussLegendreCorrectness();
+    TestTensorGaussLegendreThrowsOnInvalidInput();
+    TestSparseGridIntegrationCorrectness();
+    TestSparseGridIntegrationThrowsOnInvalidInput();
+    TestSobolQuasiMonteCarloCorrectness();
+    TestSobolQuasiMonteCarloThrowsOnInvalidInput();
+
     std::cout << "\n\n=== WSZYSTKIE TESTY ZAKONCZONE SUKCESEM! ===\n" << std::endl;
 
     return 0;
@@ -0,0 +1,134 @@
+// tests/test_autodiff.cpp
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include "autodiff.h"
+
+namespace {
+    void assertDoubleEqual(double a, double b, double tolerance = 1e-12) {
+        assert(std::abs(a - b) < tolerance);
+    }
+
+    // Ta sama definicja dziala dla double i Dual<N>
+    template <typename T>
+    T composite(const T& x) {
+        using std::sin; using std::exp; using std::sqrt; using std::log; using std::pow; using std::atan;
+        return sin(x) * exp(x) / (1.0 + x * x) + sqrt(x) + pow(x, 3.0) - log(x) + atan(2.0 * x);
+    }
+
+    // Trojdiagonalna funkcja Broydena
+    auto tridiagonal = [](const auto& x, auto& fx) {
+        const std::size_t n = x.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            auto value = (3.0 - 2.0 * x[i]) * x[i] + 1.0;
+            if (i > 0) value -= x[i - 1];
+            if (i + 1 < n) value -= 2.0 * x[i + 1];
+            fx[i] = value;
+        }
+    };
+}
+
+void TestAutodiffCorrectness() {
+    std::cout << "Test: autodiff - pochodne, jakobiany, Newton i jakobian dla BDF... ";
+    using namespace numeric::autodiff;
+
+    // Pochodna zlozenia wzgledem wzoru analitycznego
+    const double x = 0.7;
+    const Dual<1> d = derivative([](const auto& t) { return composite(t); }, x);
+    const double analytic = (std::cos(x) * std::exp(x) + std::sin(x) * std::exp(x)) / (1.0 + x * x) -
+                            std::sin(x) * std::exp(x) * 2.0 * x / ((1.0 + x * x) * (1.0 + x * x)) +
+                            0.5 / std::sqrt(x) + 3.0 * x * x - 1.0 / x + 2.0 / (1.0 + 4.0 * x * x);
+    assertDoubleEqual(d.value, composite(x));
+    assertDoubleEqual(d.grad[0], analytic);
+
+    // Rozgalezienia z porownaniem z double (== i != w obu kolejnosciach) kompiluja sie dla double i Dual
+    auto sinc = [](const auto& t) -> std::decay_t<decltype(t)> {
+        using std::sin;
+        if (t == 0.0 || 0.0 == t) {
+            return 1.0;
+        }
+        return (t != 0.0 && 0.0 != t) ? sin(t) / t : t;
+    };
+    assertDoubleEqual(derivative(sinc, 0.0).grad[0], 0.0);
+    assertDoubleEqual(derivative(sinc, 1.0).grad[0], std::cos(1.0) - std::sin(1.0));
+    assertDoubleEqual(sinc(1.0), std::sin(1.0));
+
+    // Newton: jedno wywolanie f na iteracje (f i f' razem)
+    int calls = 0;
+    auto root = numeric::autodiff::newtonMethod([&calls](const auto& t) { ++calls; return t * t - 9.0; }, 5.0, 1e-12);
+    assert(root.has_value());
+    assertDoubleEqual(*root, 3.0);
+    assert(calls <= 7);
+
+    // Jakobian w dwoch przebiegach Dual<2> (n = 3) rowny analitycznemu
+    std::vector<double> point = { 0.5, -1.0, 2.0 };
+    std::vector<std::vector<double>> J(3, std::vector<double>(3, 0.0));
+    std::vector<double> fx;
+    int sweeps = 0;
+    jacobian<2>([&sweeps](const auto& v, auto& out) { ++sweeps; tridiagonal(v, out); }, point, J, fx);
+    assert(sweeps == 2);
+    const double expected[3][3] = { { 3.0 - 4.0 * 0.5, -2.0, 0.0 }, { -1.0, 3.0 + 4.0, -2.0 }, { 0.0, -1.0, 3.0 - 8.0 } };
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            assertDoubleEqual(J[i][j], expected[i][j]);
+        }
+    }
+    assertDoubleEqual(fx[0], (3.0 - 1.0) * 0.5 + 1.0 + 2.0);
+
+    // Uklad rownan: brak dodatkowych wywolan F na jakobian roznicowy
+    auto system = numeric::autodiff::solveSystem(tridiagonal, std::vector<double>(20, -1.0));
+    assert(system.has_value() && system->residual < 1e-10);
+    assert(system->function_evaluations == system->iterations + 1);
+
+    // Sztywny uklad liniowy (Robertson w wersji liniowej): jakobian BDF z AD
+    auto rhs = [](double, const auto& y, auto& dydx) {
+        dydx[0] = -1000.0 * y[0] + y[1];
+        dydx[1] = y[0] - 2.0 * y[1];
+    };
+    numeric::ode::StiffOptions options;
+    options.jacobian = odeJacobian(rhs);
+    auto stiff = numeric::ode::bdfSystem(rhs, 0.0, { 1.0, 1.0 }, 0.01, 1.0, 2, options);
+    auto reference = numeric::ode::bdfSystem(rhs, 0.0, { 1.0, 1.0 }, 0.01, 1.0, 2);
+    assert(stiff.has_value() && reference.has_value());
+    assert(stiff->rhs_evaluations < reference->rhs_evaluations);
+    const auto& a = stiff->trajectory;
+    const auto& b = reference->trajectory;
+    assertDoubleEqual(a.state(a.size() - 1)[1], b.state(b.size() - 1)[1], 1e-6);
+    std::cout << "OK" << std::endl;
+}
+
+void TestAutodiffThrowsOnInvalidInput() {
+    std::cout << "Test: autodiff - niepoprawne dane... ";
+    using namespace numeric::autodiff;
+    auto square = [](const auto& t) { return t * t - 2.0; };
+    try {
+        numeric::autodiff::newtonMethod(square, 1.0, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        numeric::autodiff::newtonMethod(square, 1.0, 1e-7, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::vector<double> fx;
+    std::vector<std::vector<double>> empty;
+    try {
+        jacobian(tridiagonal, std::vector<double>{ 1.0 }, empty, fx);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::vector<std::vector<double>> wrong(2, std::vector<double>(3, 0.0));
+    try {
+        jacobian(tridiagonal, std::vector<double>{ 1.0, 2.0 }, wrong, fx);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    // Zerowa pochodna w punkcie startowym
+    assert(!numeric::autodiff::newtonMethod(square, 0.0).has_value());
+    std::cout << "OK" << std::endl;
+}
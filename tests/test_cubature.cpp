@@ -0,0 +1,100 @@
+// tests/test_cubature.cpp
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include "cubature.h"
+
+namespace {
+    void assertDoubleEqual(double a, double b, double tolerance = 1e-7) {
+        assert(std::abs(a - b) < tolerance);
+    }
+    // exp(x1 + ... + xd) na [0, 1]^d, calka to (e - 1)^d
+    auto f_exp_sum = [](const std::vector<double>& x) {
+        double s = 0.0;
+        for (double v : x) s += v;
+        return std::exp(s);
+    };
+}
+
+void TestTensorGaussLegendreCorrectness() {
+    std::cout << "Test: tensorGaussLegendre - poprawnosc wyniku... ";
+    std::vector<double> lower(3, 0.0), upper(3, 1.0);
+    auto result = numeric::cubature::tensorGaussLegendre(f_exp_sum, lower, upper, 6);
+    assertDoubleEqual(result.value, std::pow(std::exp(1.0) - 1.0, 3), 1e-10);
+    assert(result.evaluations == 6 * 6 * 6 + 5 * 5 * 5);
+    assert(result.error_estimate < 1e-6);
+    std::cout << "OK" << std::endl;
+}
+
+void TestTensorGaussLegendreThrowsOnInvalidInput() {
+    std::cout << "Test: tensorGaussLegendre - rozne rozmiary granic... ";
+    try {
+        numeric::cubature::tensorGaussLegendre(f_exp_sum, {0.0, 0.0}, {1.0}, 4);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestSparseGridIntegrationCorrectness() {
+    std::cout << "Test: sparseGridIntegration - poprawnosc wyniku... ";
+    std::vector<double> lower(8, 0.0), upper(8, 1.0);
+    auto result = numeric::cubature::sparseGridIntegration(f_exp_sum, lower, upper, 5);
+    double exact = std::pow(std::exp(1.0) - 1.0, 8);
+    assertDoubleEqual(result.value, exact, 1e-5 * exact);
+    // Siatka tensorowa o tej samej dokladnosci 1-D mialaby 33^8 punktow
+    assert(result.evaluations < 100000);
+    assert(std::abs(result.value - exact) < 10.0 * result.error_estimate + 1e-12);
+    std::cout << "OK" << std::endl;
+}
+
+void TestSparseGridIntegrationThrowsOnInvalidInput() {
+    std::cout << "Test: sparseGridIntegration - niepoprawny poziom... ";
+    try {
+        numeric::cubature::sparseGridIntegration(f_exp_sum, {0.0}, {1.0}, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestSobolQuasiMonteCarloCorrectness() {
+    std::cout << "Test: sobolQuasiMonteCarlo - poprawnosc wyniku... ";
+    std::vector<double> lower(20, 0.0), upper(20, 1.0);
+    // Suma wspolrzednych na [0, 1]^20, calka to 10
+    auto f_sum = [](const std::vector<double>& x) {
+        double s = 0.0;
+        for (double v : x) s += v;
+        return s;
+    };
+    auto serial = numeric::cubature::sobolQuasiMonteCarlo(f_sum, lower, upper, 4096, 8, 42, 1);
+    auto parallel = numeric::cubature::sobolQuasiMonteCarlo(f_sum, lower, upper, 4096, 8, 42, 4);
+    assertDoubleEqual(serial.value, 10.0, 1e-3);
+    assertDoubleEqual(serial.value, parallel.value, 1e-12);
+    assert(serial.evaluations == 4096 * 8);
+    assert(serial.error_estimate < 1e-3);
+    std::cout << "OK" << std::endl;
+}
+
+void TestSobolQuasiMonteCarloThrowsOnInvalidInput() {
+    std::cout << "Test: sobolQuasiMonteCarlo - za duzy wymiar... ";
+    std::vector<double> lower(22, 0.0), upper(22, 1.0);
+    try {
+        numeric::cubature::sobolQuasiMonteCarlo(f_exp_sum, lower, upper, 1024);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    // Wyjatek z funkcji podcalkowej liczonej na kilku watkach dociera do wywolujacego
+    numeric::cubature::MultiFunction f_throwing = [](const std::vector<double>&) -> double {
+        throw std::runtime_error("blad funkcji");
+    };
+    try {
+        numeric::cubature::sobolQuasiMonteCarlo(f_throwing, { 0.0 }, { 1.0 }, 64, 4, 0, 2);
+        assert(false);
+    } catch (const std::runtime_error&) {
+        std::cout << "OK" << std::endl;
+    }
+}
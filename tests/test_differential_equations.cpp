@@ -4,6 +4,7 @@
 #include <cmath>
 #include <stdexcept>
 #include "differential_equations.h"
+#include "runge_kutta.h"
 
 namespace {
     void assertDoubleEqual(double a, double b, double tolerance = 1e-5) {
@@ -79,4 +80,403 @@ void TestRungeKutta4ThrowsOnInvalidInput() {
     } catch (const std::invalid_argument&) {
         std::cout << "OK" << std::endl;
     }
-}
\ No newline at end of file
+}
+void TestSystemMethodsCorrectness() {
+    std::cout << "Test: eulerSystem/heunSystem/midpointSystem/rungeKutta4System - oscylator harmoniczny... ";
+    // y'' = -y jako uklad: y0' = y1, y1' = -y0; y(0) = (0, 1) -> y0(x) = sin(x)
+    numeric::ode::OdeSystemFunction oscillator = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = y[1];
+        dydx[1] = -y[0];
+    };
+    std::vector<double> y0 = {0.0, 1.0};
+    auto rk4 = numeric::ode::rungeKutta4System(oscillator, 0.0, y0, 0.01, 1.0);
+    assert(rk4.size() == 101);
+    assertDoubleEqual(rk4.x.back(), 1.0, 1e-12);
+    assertDoubleEqual(rk4.state(100)[0], std::sin(1.0), 1e-9);
+    assertDoubleEqual(rk4.state(100)[1], std::cos(1.0), 1e-9);
+    auto heun = numeric::ode::heunSystem(oscillator, 0.0, y0, 0.01, 1.0);
+    assertDoubleEqual(heun.state(100)[0], std::sin(1.0), 1e-4);
+    auto midpoint = numeric::ode::midpointSystem(oscillator, 0.0, y0, 0.01, 1.0);
+    assertDoubleEqual(midpoint.state(100)[0], std::sin(1.0), 1e-4);
+    auto euler = numeric::ode::eulerSystem(oscillator, 0.0, y0, 0.001, 1.0);
+    assertDoubleEqual(euler.state(1000)[0], std::sin(1.0), 1e-2);
+    std::cout << "OK" << std::endl;
+}
+
+void TestSystemMethodsThrowOnInvalidInput() {
+    std::cout << "Test: rungeKutta4System - pusty stan poczatkowy... ";
+    numeric::ode::OdeSystemFunction f_zero = [](double, const std::vector<double>&, std::vector<double>& dydx) {
+        for (double& d : dydx) d = 0.0;
+    };
+    try {
+        numeric::ode::rungeKutta4System(f_zero, 0.0, {}, 0.1, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestAdaptiveMethodsCorrectness() {
+    std::cout << "Test: dormandPrince45/bogackiShampine32 - dokladnosc i rozwiazanie ciagle... ";
+    numeric::ode::OdeSystemFunction oscillator = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = y[1];
+        dydx[1] = -y[0];
+    };
+    numeric::ode::AdaptiveOptions options;
+    options.abs_tol = 1e-10;
+    options.rel_tol = 1e-10;
+    auto dp = numeric::ode::dormandPrince45(oscillator, 0.0, {0.0, 1.0}, 10.0, options);
+    assert(dp.has_value());
+    assertDoubleEqual(dp->steps.x.back(), 10.0, 1e-14);
+    assertDoubleEqual(dp->steps.state(dp->steps.size() - 1)[0], std::sin(10.0), 1e-8);
+    // FSAL: 6 nowych wywolan na krok + start
+    assert(dp->rhs_evaluations == 2 + 6 * (dp->accepted_steps + dp->rejected_steps));
+    // Rozwiazanie ciagle pomiedzy krokami
+    for (double x = 0.0; x <= 10.0; x += 0.37) {
+        assertDoubleEqual(dp->dense(x)[0], std::sin(x), 1e-8);
+    }
+
+    options.abs_tol = 1e-6;
+    options.rel_tol = 1e-6;
+    auto bs = numeric::ode::bogackiShampine32(oscillator, 0.0, {0.0, 1.0}, 10.0, options);
+    assert(bs.has_value());
+    assertDoubleEqual(bs->steps.state(bs->steps.size() - 1)[0], std::sin(10.0), 1e-4);
+    assertDoubleEqual(bs->dense(5.55)[1], std::cos(5.55), 1e-4);
+    std::cout << "OK" << std::endl;
+}
+
+void TestAdaptiveMethodsThrowOnInvalidInput() {
+    std::cout << "Test: dormandPrince45 - niepoprawna tolerancja... ";
+    numeric::ode::OdeSystemFunction f_zero = [](double, const std::vector<double>&, std::vector<double>& dydx) {
+        for (double& d : dydx) d = 0.0;
+    };
+    numeric::ode::AdaptiveOptions options;
+    options.abs_tol = 0.0;
+    try {
+        numeric::ode::dormandPrince45(f_zero, 0.0, {1.0}, 1.0, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestObserversCorrectness() {
+    std::cout << "Test: obserwatorzy - stan koncowy, decymacja i punkty wyjsciowe... ";
+    using namespace numeric::ode;
+    // Obserwator widzi dokladnie te same punkty co wersja zwracajaca wektor
+    auto full = rungeKutta4(f_ode_exp, 0.0, 1.0, 0.1, 1.0);
+    SolutionPoint last{};
+    rungeKutta4(f_ode_exp, 0.0, 1.0, 0.1, 1.0, finalStateObserver(last));
+    assert(last.x == full.back().x && last.y == full.back().y);
+
+    std::vector<SolutionPoint> decimated;
+    rungeKutta4(f_ode_exp, 0.0, 1.0, 0.1, 1.0, strideObserver(5, decimated));
+    assert(decimated.size() == 3);
+    assert(decimated[1].y == full[5].y);
+
+    std::vector<SolutionPoint> sampled;
+    rungeKutta4(f_ode_exp, 0.0, 1.0, 0.01, 1.0, outputAtObserver(f_ode_exp, {0.555, 0.123, 2.0}, sampled));
+    assert(sampled.size() == 2);
+    assertDoubleEqual(sampled[0].x, 0.123, 1e-15);
+    assertDoubleEqual(sampled[0].y, std::exp(0.123), 1e-8);
+    assertDoubleEqual(sampled[1].y, std::exp(0.555), 1e-8);
+
+    // Uklad: probkowanie oscylatora w punktach pomiedzy krokami
+    OdeSystemFunction oscillator = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = y[1];
+        dydx[1] = -y[0];
+    };
+    SystemSolution at_points;
+    rungeKutta4System(oscillator, 0.0, {0.0, 1.0}, 0.01, 2.0, outputAtObserver(oscillator, {0.005, 1.2345}, at_points));
+    assert(at_points.size() == 2);
+    assertDoubleEqual(at_points.state(1)[0], std::sin(1.2345), 1e-8);
+    SystemSolutionPoint final_state;
+    rungeKutta4System(oscillator, 0.0, {0.0, 1.0}, 0.01, 2.0, finalStateObserver(final_state));
+    assertDoubleEqual(final_state.x, 2.0, 1e-12);
+    assertDoubleEqual(final_state.y[0], std::sin(2.0), 1e-8);
+    std::cout << "OK" << std::endl;
+}
+
+void TestObserversThrowOnInvalidInput() {
+    std::cout << "Test: strideObserver - zerowy krok decymacji... ";
+    std::vector<numeric::ode::SolutionPoint> out;
+    try {
+        numeric::ode::strideObserver(0, out);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestEnsembleCorrectness() {
+    std::cout << "Test: rungeKutta4Ensemble - zespol oscylatorow w blokach i watkach... ";
+    using namespace numeric::ode;
+    // Czestosc kazdego czlonka jest trzecia skladowa stanu o zerowej pochodnej
+    EnsembleFunction oscillators = [](double, const double* y, double* dydx, std::size_t count) {
+        const double* pos = y;
+        const double* vel = y + count;
+        const double* omega = y + 2 * count;
+        for (std::size_t m = 0; m < count; ++m) {
+            dydx[m] = vel[m];
+            dydx[count + m] = -omega[m] * omega[m] * pos[m];
+            dydx[2 * count + m] = 0.0;
+        }
+    };
+    const std::size_t members = 1000;
+    EnsembleState initial(3, members);
+    for (std::size_t m = 0; m < members; ++m) {
+        initial.at(m, 0) = 0.0;
+        initial.at(m, 1) = 1.0;
+        initial.at(m, 2) = 1.0 + 0.001 * static_cast<double>(m);
+    }
+    auto serial = rungeKutta4Ensemble(oscillators, 0.0, initial, 0.01, 1.0);
+    auto parallel = rungeKutta4Ensemble(oscillators, 0.0, initial, 0.01, 1.0, 3);
+    assert(serial.y == parallel.y);
+    for (std::size_t m = 0; m < members; m += 97) {
+        const double omega = initial.at(m, 2);
+        assertDoubleEqual(serial.at(m, 0), std::sin(omega) / omega, 1e-8);
+        assertDoubleEqual(serial.at(m, 1), std::cos(omega), 1e-8);
+    }
+
+    // Obserwator widzi kazdego czlonka w kazdym punkcie dokladnie raz
+    std::vector<int> visits(members, 0);
+    rungeKutta4Ensemble(oscillators, 0.0, initial, 0.1, 1.0, 1,
+                        [&visits](double, const double*, std::size_t first, std::size_t count) {
+                            for (std::size_t m = first; m < first + count; ++m) ++visits[m];
+                        });
+    for (int v : visits) assert(v == 11);
+    std::cout << "OK" << std::endl;
+}
+
+void TestEnsembleThrowsOnInvalidInput() {
+    std::cout << "Test: rungeKutta4Ensemble - niezgodny rozmiar stanu... ";
+    numeric::ode::EnsembleState initial(2, 10);
+    initial.y.pop_back();
+    try {
+        numeric::ode::rungeKutta4Ensemble([](double, const double*, double*, std::size_t) {}, 0.0, initial, 0.1, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+namespace {
+    // Rzad zbieznosci metody wyznaczony z bledow dla krokow h i h/2 (y' = y cos x, y = exp(sin x))
+    template <typename Tableau>
+    double observedOrder() {
+        auto f = [](double x, double y) { return y * std::cos(x); };
+        double errors[2];
+        for (int i = 0; i < 2; ++i) {
+            double last = 0.0;
+            numeric::ode::explicitRungeKutta<Tableau>(f, 0.0, 1.0, 0.0625 / (1 << i), 2.0,
+                                                      [&last](double, double y) { last = y; });
+            errors[i] = std::abs(last - std::exp(std::sin(2.0)));
+        }
+        return std::log2(errors[0] / errors[1]);
+    }
+}
+
+void TestRungeKuttaEngineCorrectness() {
+    std::cout << "Test: explicitRungeKutta - rzedy zbieznosci tablic Butchera... ";
+    using namespace numeric::ode;
+    assert(std::abs(observedOrder<EulerTableau>() - 1.0) < 0.2);
+    assert(std::abs(observedOrder<MidpointTableau>() - 2.0) < 0.2);
+    assert(std::abs(observedOrder<Kutta3Tableau>() - 3.0) < 0.2);
+    assert(std::abs(observedOrder<Ssprk3Tableau>() - 3.0) < 0.2);
+    assert(std::abs(observedOrder<Rk4Tableau>() - 4.0) < 0.2);
+    assert(std::abs(observedOrder<Rk38Tableau>() - 4.0) < 0.2);
+    assert(std::abs(observedOrder<Butcher6Tableau>() - 6.0) < 0.3);
+
+    // Wersja ukladowa z lambda daje te same punkty co rungeKutta4System
+    auto oscillator = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = y[1];
+        dydx[1] = -y[0];
+    };
+    auto reference = rungeKutta4System(oscillator, 0.0, {0.0, 1.0}, 0.1, 1.0);
+    std::vector<double> states;
+    explicitRungeKuttaSystem<Rk4Tableau>(oscillator, 0.0, std::vector<double>{0.0, 1.0}, 0.1, 1.0,
+                                         [&states](double, const std::vector<double>& y) {
+                                             states.insert(states.end(), y.begin(), y.end());
+                                         });
+    assert(states == reference.y);
+    std::cout << "OK" << std::endl;
+}
+
+void TestRungeKuttaEngineThrowsOnInvalidInput() {
+    std::cout << "Test: explicitRungeKutta - niedodatni krok... ";
+    try {
+        numeric::ode::explicitRungeKutta<numeric::ode::Rk4Tableau>([](double, double y) { return y; }, 0.0, 1.0, 0.0, 1.0,
+                                                                  [](double, double) {});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestAdamsBashforthMoultonCorrectness() {
+    std::cout << "Test: adamsBashforthMoulton - rzad i koszt PECE... ";
+    using namespace numeric::ode;
+    long long calls = 0;
+    OdeSystemFunction oscillator = [&calls](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        ++calls;
+        dydx[0] = y[1];
+        dydx[1] = -y[0];
+    };
+    for (int order = 2; order <= 5; ++order) {
+        double errors[2];
+        for (int i = 0; i < 2; ++i) {
+            auto sol = adamsBashforthMoulton(oscillator, 0.0, {0.0, 1.0}, 0.02 / (1 << i), 10.0, order);
+            errors[i] = std::abs(sol.state(sol.size() - 1)[0] - std::sin(10.0));
+        }
+        assert(std::abs(std::log2(errors[0] / errors[1]) - order) < 0.3);
+    }
+    // 1000 krokow: start RK4 (3 kroki) i po dwa wywolania f na krok
+    calls = 0;
+    adamsBashforthMoulton(oscillator, 0.0, {0.0, 1.0}, 0.01, 10.0, 4);
+    assert(calls == 1 + 3 * 5 + 997 * 2);
+
+    // Zmienny krok: mniej wywolan f niz Dormand-Prince przy tej samej tolerancji na dlugim przedziale
+    AdaptiveOptions options;
+    options.abs_tol = options.rel_tol = 1e-8;
+    auto adams = adamsBashforthMoultonAdaptive(oscillator, 0.0, {0.0, 1.0}, 50.0, 5, options);
+    auto dopri = dormandPrince45(oscillator, 0.0, {0.0, 1.0}, 50.0, options);
+    assert(adams.has_value() && dopri.has_value());
+    assert(adams->steps.x.back() == 50.0);
+    assertDoubleEqual(adams->steps.state(adams->steps.size() - 1)[0], std::sin(50.0), 1e-4);
+    assertDoubleEqual(adams->dense(12.34)[0], std::sin(12.34), 1e-4);
+    assert(adams->rhs_evaluations < dopri->rhs_evaluations);
+
+    // Waski impuls w x = 5 po dlugim gladkim odcinku: odrzucenie kroku korektora wymusza ponowny start
+    // przy krokach za duzych dla impulsu, wiec kroki startowe tez musza kontrolowac blad
+    const double width = 0.02;
+    OdeSystemFunction pulse = [width](double x, const std::vector<double>&, std::vector<double>& dydx) {
+        const double u = (x - 5.0) / width;
+        dydx[0] = std::cos(x) + std::exp(-u * u) / (width * std::sqrt(std::acos(-1.0)));
+    };
+    auto pulsed = adamsBashforthMoultonAdaptive(pulse, 0.0, {1.0}, 10.0, 4, options);
+    assert(pulsed.has_value() && pulsed->rejected_steps > 0);
+    for (std::size_t i = 0; i < pulsed->steps.size(); ++i) {
+        const double x = pulsed->steps.x[i];
+        const double exact = 1.0 + std::sin(x) + 0.5 * (1.0 + std::erf((x - 5.0) / width));
+        assertDoubleEqual(pulsed->steps.y[i], exact, 1e-5);
+    }
+    // Zerowe oszacowanie bledu (f = 0) tez pozwala powiekszac krok
+    OdeSystemFunction constant = [](double, const std::vector<double>&, std::vector<double>& dydx) { dydx[0] = 0.0; };
+    auto flat = adamsBashforthMoultonAdaptive(constant, 0.0, {1.0}, 100.0, 4, options);
+    assert(flat.has_value() && flat->accepted_steps < 100);
+    std::cout << "OK" << std::endl;
+}
+
+void TestAdamsBashforthMoultonThrowsOnInvalidInput() {
+    std::cout << "Test: adamsBashforthMoulton - niepoprawny rzad... ";
+    numeric::ode::OdeSystemFunction f = [](double, const std::vector<double>& y, std::vector<double>& dydx) { dydx = y; };
+    try {
+        numeric::ode::adamsBashforthMoulton(f, 0.0, {1.0}, 0.1, 1.0, 6);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestEventsCorrectness() {
+    std::cout << "Test: rungeKutta4Events/dormandPrince45Events - zdarzenia terminalne i kierunek... ";
+    using namespace numeric::ode;
+    // Spadek swobodny z wysokosci 10: zdarzenie terminalne przy y = 0
+    OdeSystemFunction fall = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = y[1];
+        dydx[1] = -9.81;
+    };
+    OdeEvent impact;
+    impact.g = [](double, const std::vector<double>& y) { return y[0]; };
+    impact.terminal = true;
+    const double t_impact = std::sqrt(2.0 * 10.0 / 9.81);
+    auto fixed = rungeKutta4Events(fall, 0.0, {10.0, 0.0}, 0.1, 100.0, {impact});
+    assert(fixed.terminated && fixed.events.size() == 1);
+    assertDoubleEqual(fixed.events[0].x, t_impact, 1e-10);
+    assert(fixed.trajectory.x.back() == fixed.events[0].x);
+    assert(fixed.trajectory.size() == 16);
+
+    // Oscylator: sin x rosnie przez zero w 2*pi i 4*pi, maleje w pi, 3*pi, 5*pi
+    OdeSystemFunction oscillator = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = y[1];
+        dydx[1] = -y[0];
+    };
+    OdeEvent rising;
+    rising.g = [](double, const std::vector<double>& y) { return y[0]; };
+    rising.direction = EventDirection::Rising;
+    OdeEvent any_crossing = rising;
+    any_crossing.direction = EventDirection::Any;
+    const double pi = std::acos(-1.0);
+    auto adaptive = dormandPrince45Events(oscillator, 0.0, {0.0, 1.0}, 16.0, {rising, any_crossing});
+    assert(adaptive.has_value() && !adaptive->terminated);
+    assert(adaptive->events.size() == 7);
+    assert(adaptive->events[0].index == 1 && adaptive->events[1].index == 0);
+    assertDoubleEqual(adaptive->events[0].x, pi, 1e-7);
+    assertDoubleEqual(adaptive->events[1].x, 2.0 * pi, 1e-7);
+    assertDoubleEqual(adaptive->events[1].y[1], 1.0, 1e-7);
+    assert(adaptive->steps.x.back() == 16.0);
+
+    // Zdarzenie terminalne skraca takze rozwiazanie ciagle
+    OdeEvent stop = rising;
+    stop.terminal = true;
+    auto stopped = dormandPrince45Events(oscillator, 0.0, {0.0, 1.0}, 16.0, {stop});
+    assert(stopped.has_value() && stopped->terminated);
+    assertDoubleEqual(stopped->dense.xEnd(), 2.0 * pi, 1e-7);
+    assertDoubleEqual(stopped->dense(6.0)[0], std::sin(6.0), 1e-6);
+    std::cout << "OK" << std::endl;
+}
+
+void TestEventsThrowOnInvalidInput() {
+    std::cout << "Test: rungeKutta4Events - pusta funkcja zdarzenia... ";
+    numeric::ode::OdeSystemFunction f = [](double, const std::vector<double>& y, std::vector<double>& dydx) { dydx = y; };
+    try {
+        numeric::ode::rungeKutta4Events(f, 0.0, {1.0}, 0.1, 1.0, {numeric::ode::OdeEvent{}});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestPararealCorrectness() {
+    std::cout << "Test: parareal - zbieznosc do sekwencyjnego propagatora fine... ";
+    using namespace numeric::ode;
+    OdeSystemFunction oscillator = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = y[1];
+        dydx[1] = -y[0];
+    };
+    PararealOptions options;
+    options.slices = 20;
+    options.threads = 4;
+    auto coarse = rungeKutta4Propagator(oscillator, 2);
+    auto fine = rungeKutta4Propagator(oscillator, 100);
+    auto result = parareal(coarse, fine, 0.0, {0.0, 1.0}, 20.0, options);
+    // Referencja: ten sam propagator fine sekwencyjnie (h = 0.01)
+    auto serial = rungeKutta4System(oscillator, 0.0, {0.0, 1.0}, 0.01, 20.0);
+    assert(result.converged && result.iterations < options.slices);
+    assert(result.boundaries.size() == 21);
+    assert(result.boundaries.x.back() == 20.0);
+    assertDoubleEqual(result.boundaries.state(20)[0], serial.state(serial.size() - 1)[0], 1e-9);
+    assertDoubleEqual(result.boundaries.state(10)[1], std::cos(10.0), 1e-7);
+    assert(result.serial_fine_seconds > 0.0 && result.speedup > 0.0);
+
+    // Z Eulerem jako coarse i max_iterations = slices wynik jest dokladnie sekwencyjnym fine
+    options.tol = 0.0;
+    auto exact = parareal(eulerPropagator(oscillator, 1), fine, 0.0, {0.0, 1.0}, 20.0, options);
+    assert(exact.iterations == options.slices);
+    assertDoubleEqual(exact.boundaries.state(20)[0], serial.state(serial.size() - 1)[0], 1e-12);
+    std::cout << "OK" << std::endl;
+}
+
+void TestPararealThrowsOnInvalidInput() {
+    std::cout << "Test: parareal - niepoprawna liczba przedzialow... ";
+    numeric::ode::OdeSystemFunction f = [](double, const std::vector<double>& y, std::vector<double>& dydx) { dydx = y; };
+    numeric::ode::PararealOptions options;
+    options.slices = 0;
+    try {
+        auto propagator = numeric::ode::rungeKutta4Propagator(f, 10);
+        numeric::ode::parareal(propagator, propagator, 0.0, {1.0}, 1.0, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
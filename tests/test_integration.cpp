@@ -2,6 +2,7 @@
 #include <cassert>
 #include <cmath>
 #include <stdexcept>
+#include <sstream>
 #include "integration.h"
 
 namespace {
@@ -98,4 +99,196 @@ void TestSegmentedGaussLegendreThrowsOnInvalidInput() {
     } catch (const std::invalid_argument&) {
         std::cout << "OK" << std::endl;
     }
-}
\ No newline at end of file
+}
+void TestRombergIntegrationCorrectness() {
+    std::cout << "Test: rombergIntegration - poprawnosc wyniku i liczba wywolan... ";
+    int calls = 0;
+    auto f_sin = [&calls](double x){ ++calls; return std::sin(x); }; // Calka od 0 do pi to 2
+    auto result = numeric::integration::rombergIntegration(f_sin, 0.0, std::acos(-1.0), 1e-10);
+    assert(result.has_value());
+    assertDoubleEqual(result->value, 2.0, 1e-9);
+    assert(result->evaluations == calls);
+    // Wszystkie poziomy to 2^k + 1 punktow - kazdy punkt liczony dokladnie raz
+    assert(((calls - 1) & (calls - 2)) == 0);
+    std::cout << "OK" << std::endl;
+}
+
+void TestRombergIntegrationThrowsOnInvalidInput() {
+    std::cout << "Test: rombergIntegration - niepoprawna tolerancja... ";
+    try {
+        numeric::integration::rombergIntegration(f_linear, 0.0, 1.0, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestBatchRulesMatchScalarRules() {
+    std::cout << "Test: reguly blokowe - zgodnosc z wersjami skalarnymi... ";
+    auto f_scalar = [](double x){ return std::exp(-x) * std::cos(3.0 * x); };
+    int batch_calls = 0;
+    numeric::integration::BatchFunction f_batch = [&](const double* x, double* fx, std::size_t count) {
+        ++batch_calls;
+        for (std::size_t i = 0; i < count; ++i) fx[i] = std::exp(-x[i]) * std::cos(3.0 * x[i]);
+    };
+    using namespace numeric::integration;
+    assertDoubleEqual(rectangleRuleBatch(f_batch, 0.0, 2.0, 1000, 64), rectangleRule(f_scalar, 0.0, 2.0, 1000), 1e-12);
+    assertDoubleEqual(trapezoidalRuleBatch(f_batch, 0.0, 2.0, 1000, 64), trapezoidalRule(f_scalar, 0.0, 2.0, 1000), 1e-12);
+    assertDoubleEqual(simpsonRuleBatch(f_batch, 0.0, 2.0, 999, 64), simpsonRule(f_scalar, 0.0, 2.0, 999), 1e-12);
+    assertDoubleEqual(segmentedGaussLegendreBatch(f_batch, 0.0, 2.0, 3, 50, 64),
+                      segmentedGaussLegendre(f_scalar, 0.0, 2.0, 3, 50), 1e-12);
+    // 1000 + 1001 + 1001 + 150 punktow w blokach po 64
+    assert(batch_calls == 16 + 16 + 16 + 3);
+    std::cout << "OK" << std::endl;
+}
+
+void TestBatchRulesThrowOnInvalidInput() {
+    std::cout << "Test: reguly blokowe - niepoprawny rozmiar bloku... ";
+    numeric::integration::BatchFunction f_batch = [](const double* x, double* fx, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) fx[i] = x[i];
+    };
+    try {
+        numeric::integration::trapezoidalRuleBatch(f_batch, 0.0, 1.0, 10, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestStreamingIntegratorCorrectness() {
+    std::cout << "Test: integrateCsvStream/integrateUniformBinaryStream - poprawnosc wyniku... ";
+    using namespace numeric::integration;
+    // Niejednorodna siatka x = t^2 na [0, 1], f(x) = x^2, calka to 1/3 (Simpson dokladny dla wielomianow st. 2)
+    std::stringstream csv;
+    csv.precision(17);
+    csv << "# x,y\n";
+    for (int i = 0; i <= 101; ++i) {
+        double x = (i / 101.0) * (i / 101.0);
+        csv << x << "," << x * x << "\n";
+    }
+    double simpson = integrateCsvStream(csv, TabulatedRule::Simpson, nullptr, 16);
+    assertDoubleEqual(simpson, 1.0 / 3.0, 1e-12);
+
+    // Jednorodne probki y = 2x, calka narastajaca w kazdym punkcie to x^2
+    std::stringstream bin(std::ios::in | std::ios::out | std::ios::binary);
+    for (int i = 0; i <= 50; ++i) {
+        double y = 2.0 * (0.02 * i);
+        bin.write(reinterpret_cast<const char*>(&y), sizeof(double));
+    }
+    int samples = 0;
+    CumulativeCallback check = [&samples](double x, double integral) {
+        ++samples;
+        assertDoubleEqual(integral, x * x, 1e-12);
+    };
+    double trap = integrateUniformBinaryStream(bin, 0.0, 0.02, TabulatedRule::Trapezoidal, check, 7);
+    assertDoubleEqual(trap, 1.0, 1e-12);
+    assert(samples == 51);
+    std::cout << "OK" << std::endl;
+}
+
+void TestStreamingIntegratorThrowsOnInvalidInput() {
+    std::cout << "Test: StreamingIntegrator - malejace x... ";
+    numeric::integration::StreamingIntegrator integrator(numeric::integration::TabulatedRule::Simpson);
+    integrator.addSample(1.0, 0.0);
+    try {
+        integrator.addSample(0.5, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestDoubleExponentialIntegrationCorrectness() {
+    std::cout << "Test: tanhSinh/expSinh/sinhSinhIntegration - poprawnosc wyniku... ";
+    using namespace numeric::integration;
+    const double pi = std::acos(-1.0);
+    // Osobliwosc na koncu przedzialu: calka 1/sqrt(x) od 0 do 1 to 2
+    auto singular = tanhSinhIntegration([](double x){ return 1.0 / std::sqrt(x); }, 0.0, 1.0, 1e-10);
+    assert(singular.has_value());
+    assertDoubleEqual(singular->value, 2.0, 1e-10);
+    assert(singular->evaluations < 500);
+    // Calka exp(-x) od 0 do inf to 1
+    auto half_line = expSinhIntegration([](double x){ return std::exp(-x); }, 0.0, 1e-10);
+    assert(half_line.has_value());
+    assertDoubleEqual(half_line->value, 1.0, 1e-9);
+    // Calka 1/(1+x^2) po calej prostej to pi
+    auto full_line = sinhSinhIntegration([](double x){ return 1.0 / (1.0 + x * x); }, 1e-10);
+    assert(full_line.has_value());
+    assertDoubleEqual(full_line->value, pi, 1e-9);
+    std::cout << "OK" << std::endl;
+}
+
+void TestDoubleExponentialIntegrationThrowsOnInvalidInput() {
+    std::cout << "Test: tanhSinhIntegration - odwrocone granice... ";
+    try {
+        numeric::integration::tanhSinhIntegration(f_linear, 1.0, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestGaussLaguerreHermiteCorrectness() {
+    std::cout << "Test: gaussLaguerre/gaussHermite - poprawnosc wyniku... ";
+    using namespace numeric::integration;
+    const double sqrt_pi = std::sqrt(std::acos(-1.0));
+    // Calka x^5 e^{-x} od 0 do inf to 5! = 120 (3 wezly sa dokladne do stopnia 5)
+    assertDoubleEqual(gaussLaguerre([](double x){ return std::pow(x, 5); }, 3), 120.0, 1e-9);
+    // Uogolniona waga: calka x^{1/2} e^{-x} to Gamma(3/2) = sqrt(pi)/2
+    assertDoubleEqual(gaussLaguerre([](double){ return 1.0; }, 5, 0.5), sqrt_pi / 2.0, 1e-12);
+    // Calka cos(x) e^{-x^2} to sqrt(pi) e^{-1/4}
+    assertDoubleEqual(gaussHermite([](double x){ return std::cos(x); }, 20), sqrt_pi * std::exp(-0.25), 1e-12);
+    // Uogolniona waga |x|^2 e^{-x^2}: calka to Gamma(3/2)
+    assertDoubleEqual(gaussHermite([](double){ return 1.0; }, 4, 1.0), sqrt_pi / 2.0, 1e-12);
+    // Wysoki rzad
+    assertDoubleEqual(gaussHermite([](double x){ return x * x; }, 300), sqrt_pi / 2.0, 1e-10);
+    std::cout << "OK" << std::endl;
+}
+
+void TestGaussLaguerreHermiteThrowsOnInvalidInput() {
+    std::cout << "Test: gaussLaguerre - niepoprawny parametr alpha... ";
+    try {
+        numeric::integration::gaussLaguerre(f_linear, 4, -1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestVectorIntegrationCorrectness() {
+    std::cout << "Test: segmentedGaussLegendreVector/adaptiveSimpsonVector - poprawnosc wyniku... ";
+    using namespace numeric::integration;
+    // Momenty x^k na [0, 1]: calka to 1/(k+1)
+    const std::size_t moments = 6;
+    int calls = 0;
+    VectorFunction f_moments = [&calls](double x, double* values) {
+        ++calls;
+        double p = 1.0;
+        for (std::size_t k = 0; k < moments; ++k) { values[k] = p; p *= x; }
+    };
+    auto gl = segmentedGaussLegendreVector(f_moments, moments, 0.0, 1.0, 3, 4);
+    assert(gl.size() == moments);
+    for (std::size_t k = 0; k < moments; ++k) assertDoubleEqual(gl[k], 1.0 / (k + 1.0), 1e-12);
+    assert(calls == 12);
+
+    // Wspolczynniki Fouriera sin(k x) na [0, pi]: calka to (1 - cos(k pi)) / k
+    const double pi = std::acos(-1.0);
+    VectorFunction f_fourier = [](double x, double* values) {
+        for (int k = 1; k <= 4; ++k) values[k - 1] = std::sin(k * x);
+    };
+    auto adaptive = adaptiveSimpsonVector(f_fourier, 4, 0.0, pi, 1e-10);
+    assert(adaptive.has_value());
+    for (int k = 1; k <= 4; ++k) assertDoubleEqual(adaptive->values[k - 1], (1.0 - std::cos(k * pi)) / k, 1e-9);
+    std::cout << "OK" << std::endl;
+}
+
+void TestVectorIntegrationThrowsOnInvalidInput() {
+    std::cout << "Test: adaptiveSimpsonVector - zero skladowych... ";
+    numeric::integration::VectorFunction f_dummy = [](double, double*) {};
+    try {
+        numeric::integration::adaptiveSimpsonVector(f_dummy, 0, 0.0, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
@@ -59,4 +59,64 @@ void TestLuDecompositionThrowsOnInvalidInput() {
     } catch (const std::runtime_error&) {
         std::cout << "OK" << std::endl;
     }
-}
\ No newline at end of file
+}
+
+void TestLuFactorizeReuse() {
+    std::cout << "Test: luFactorize/luSolve - wiele prawych stron z jednym rozkladem... ";
+    std::vector<std::vector<double>> A = {{1, 4, 1}, {1, 6, -1}, {2, -1, 2}};
+    auto lu = numeric::linear_algebra::luFactorize(A);
+    assertVectorsEqual(numeric::linear_algebra::luSolve(lu, {7, 13, 5}), {5, 1, -2});
+    std::vector<double> x;
+    numeric::linear_algebra::luSolve(lu, {6, 6, 3}, x);
+    assertVectorsEqual(x, {1, 1, 1});
+    std::cout << "OK" << std::endl;
+}
+
+void TestBandedLuCorrectness() {
+    std::cout << "Test: bandedLuFactorize/bandedLuSolve - zgodnosc z mnozeniem i pivoting... ";
+    // Macierz z 1 podprzekatna i 2 nadprzekatnymi; male elementy na diagonali wymuszaja zamiany wierszy
+    const std::size_t n = 8;
+    numeric::linear_algebra::BandedMatrix A(n, 1, 2);
+    for (std::size_t i = 0; i < n; ++i) {
+        A(i, i) = (i % 2 == 0) ? 1e-3 : 4.0;
+        if (i >= 1) A(i, i - 1) = 2.0 + 0.1 * static_cast<double>(i);
+        if (i + 1 < n) A(i, i + 1) = -1.0;
+        if (i + 2 < n) A(i, i + 2) = 0.5;
+    }
+    assert(A.inBand(3, 2) && A.inBand(3, 5) && !A.inBand(3, 1) && !A.inBand(3, 6));
+    std::vector<double> x_true(n), b;
+    for (std::size_t i = 0; i < n; ++i) {
+        x_true[i] = 1.0 + static_cast<double>(i) * 0.25;
+    }
+    numeric::linear_algebra::bandedMultiply(A, x_true, b);
+    auto lu = numeric::linear_algebra::bandedLuFactorize(A);
+    assert(lu.upper == 3);
+    assertVectorsEqual(numeric::linear_algebra::bandedLuSolve(lu, b), x_true, 1e-9);
+    std::cout << "OK" << std::endl;
+}
+
+void TestBandedLuThrowsOnInvalidInput() {
+    std::cout << "Test: bandedLuFactorize - rzuca wyjatki dla zlych danych... ";
+    try {
+        numeric::linear_algebra::bandedLuFactorize(numeric::linear_algebra::BandedMatrix());
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+
+    numeric::linear_algebra::BandedMatrix singular(3, 1, 1); // Same zera
+    try {
+        numeric::linear_algebra::bandedLuFactorize(singular);
+        assert(false);
+    } catch (const std::runtime_error&) {
+    }
+
+    numeric::linear_algebra::BandedMatrix identity(2, 0, 0);
+    identity(0, 0) = identity(1, 1) = 1.0;
+    auto lu = numeric::linear_algebra::bandedLuFactorize(identity);
+    try {
+        numeric::linear_algebra::bandedLuSolve(lu, {1.0, 2.0, 3.0});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,176 @@
+// tests/test_method_of_lines.cpp
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include "method_of_lines.h"
+#include "runge_kutta.h"
+
+namespace {
+    const double kPi = 3.14159265358979323846;
+
+    void assertDoubleEqual(double a, double b, double tolerance = 1e-5) {
+        assert(std::abs(a - b) < tolerance);
+    }
+
+    // Najwiekszy blad stanu koncowego wzgledem rozwiazania dokladnego exact(x, y)
+    template <typename Exact>
+    double maxError(const numeric::pde::SemiDiscretization& disc, const double* u, Exact exact) {
+        double error = 0.0;
+        for (std::size_t i = 0; i < disc.size(); ++i) {
+            error = std::max(error, std::abs(u[i] - exact(disc.x(i), disc.y(i))));
+        }
+        return error;
+    }
+}
+
+void TestMethodOfLinesCorrectness() {
+    std::cout << "Test: discretize/thetaMethod - rownanie ciepla 1-D i 2-D, stan ustalony... ";
+    using namespace numeric::pde;
+
+    // u_t = u_xx, u(0) = u(1) = 0, u = exp(-pi^2 t) sin(pi x)
+    Problem1D heat;
+    heat.points = 101;
+    heat.diffusion = 1.0;
+    SemiDiscretization disc = discretize(heat);
+    assert(disc.size() == 99);
+    assert(disc.matrix().lower == 1 && disc.matrix().upper == 1);
+    const double t_end = 0.0625;
+    auto u0 = disc.sample([](double x, double) { return std::sin(kPi * x); });
+    auto exact = [t_end](double x, double) { return std::exp(-kPi * kPi * t_end) * std::sin(kPi * x); };
+
+    // Crank-Nicolson: krok 30 razy wiekszy niz granica stabilnosci metod jawnych
+    auto cn = thetaMethod(disc, u0, 0.0, 1.0 / 1024.0, t_end, 0.5);
+    assert(cn.size() == 65);
+    assertDoubleEqual(cn.x.back(), t_end, 1e-12);
+    assert(maxError(disc, cn.state(cn.size() - 1), exact) < 1e-4);
+
+    // Ta sama poldyskretyzacja jako uklad ODE dla jawnego RK4
+    assert(disc.explicitStepLimit() > 4.9e-5 && disc.explicitStepLimit() < 5.1e-5);
+    std::vector<double> rk_final;
+    numeric::ode::explicitRungeKuttaSystem<numeric::ode::Rk4Tableau>(disc.system(), 0.0, u0, 1.0 / 32768.0, t_end,
+        [&rk_final](double, const std::vector<double>& u) { rk_final = u; });
+    assert(maxError(disc, rk_final.data(), exact) < 1e-4);
+
+    // Neumann du/dx = 0 na obu koncach: u = exp(-pi^2 t) cos(pi x), brzegi sa niewiadomymi
+    Problem1D insulated = heat;
+    insulated.left = { BoundaryType::Neumann, 0.0 };
+    insulated.right = { BoundaryType::Neumann, 0.0 };
+    SemiDiscretization neumann = discretize(insulated);
+    assert(neumann.size() == 101);
+    auto cos_solution = thetaMethod(neumann, neumann.sample([](double x, double) { return std::cos(kPi * x); }),
+                                    0.0, 1.0 / 1024.0, t_end, 0.5);
+    assert(maxError(neumann, cos_solution.state(cos_solution.size() - 1), [t_end](double x, double) {
+        return std::exp(-kPi * kPi * t_end) * std::cos(kPi * x);
+    }) < 1e-4);
+
+    // Stan ustalony u_xx + 2 = 0, u(0) = 0, u(1) = 1: u = x(2 - x); niejawny Euler z duzym krokiem
+    Problem1D steady = heat;
+    steady.points = 21;
+    steady.right.value = 1.0;
+    steady.source = [](double, double) { return 2.0; };
+    SemiDiscretization steady_disc = discretize(steady);
+    auto steady_solution = thetaMethod(steady_disc, std::vector<double>(steady_disc.size(), 0.0), 0.0, 1.0, 50.0, 1.0);
+    assert(maxError(steady_disc, steady_solution.state(steady_solution.size() - 1),
+                    [](double x, double) { return x * (2.0 - x); }) < 1e-9);
+
+    // Adwekcja u_t = -u_x z wymuszeniem u(0) = 1 i wyplywem du/dx = 0: stan ustalony u = 1 (upwind)
+    Problem1D transport;
+    transport.points = 51;
+    transport.velocity = 1.0;
+    transport.left.value = 1.0;
+    transport.right = { BoundaryType::Neumann, 0.0 };
+    SemiDiscretization transport_disc = discretize(transport);
+    auto transported = thetaMethod(transport_disc, std::vector<double>(transport_disc.size(), 0.0), 0.0, 0.5, 100.0, 1.0);
+    assert(maxError(transport_disc, transported.state(transported.size() - 1),
+                    [](double, double) { return 1.0; }) < 1e-9);
+
+    // 2-D: u = exp(-2 pi^2 t) sin(pi x) sin(pi y), pasmo szerokosci nx - 2
+    Problem2D plate;
+    plate.nx = 41;
+    plate.ny = 41;
+    plate.diffusion = 1.0;
+    SemiDiscretization plate_disc = discretize(plate);
+    assert(plate_disc.size() == 39 * 39);
+    assert(plate_disc.matrix().lower == 39 && plate_disc.matrix().upper == 39);
+    auto plate_solution = thetaMethod(plate_disc,
+        plate_disc.sample([](double x, double y) { return std::sin(kPi * x) * std::sin(kPi * y); }),
+        0.0, 1.0 / 512.0, t_end, 0.5);
+    assert(maxError(plate_disc, plate_solution.state(plate_solution.size() - 1), [t_end](double x, double y) {
+        return std::exp(-2.0 * kPi * kPi * t_end) * std::sin(kPi * x) * std::sin(kPi * y);
+    }) < 5e-4);
+    std::cout << "OK" << std::endl;
+}
+
+void TestMethodOfLinesThrowsOnInvalidInput() {
+    std::cout << "Test: discretize/thetaMethod - rzuca wyjatki dla zlych danych... ";
+    using namespace numeric::pde;
+    Problem1D coarse;
+    coarse.points = 2;
+    try {
+        discretize(coarse);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+
+    Problem1D negative;
+    negative.diffusion = -1.0;
+    try {
+        discretize(negative);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+
+    Problem2D empty;
+    empty.y_max = empty.y_min;
+    try {
+        discretize(empty);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+
+    Problem1D heat;
+    heat.points = 11;
+    heat.diffusion = 1.0;
+    SemiDiscretization disc = discretize(heat);
+    std::vector<double> u0(disc.size(), 0.0);
+
+    try {
+        thetaMethod(disc, std::vector<double>(3, 0.0), 0.0, 0.1, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        thetaMethod(disc, u0, 0.0, 0.0, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        thetaMethod(disc, u0, 1.0, 0.1, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        thetaMethod(disc, u0, 0.0, 0.1, 1.0, 1.5);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+
+    // Czysta adwekcja centralna: a_ii = 0, wartosci wlasne na osi urojonej - brak stabilnego kroku Eulera
+    Problem1D central;
+    central.points = 21;
+    central.velocity = 1.0;
+    central.advection = AdvectionScheme::Central;
+    try {
+        discretize(central).explicitStepLimit();
+        assert(false);
+    } catch (const std::runtime_error&) {
+    }
+    // Przy malej liczbie Pecleta siatki (|a| h / D <= 2) ograniczenie istnieje i pochodzi od dyfuzji
+    central.diffusion = 1.0;
+    const double h = 1.0 / 20.0;
+    assert(std::abs(discretize(central).explicitStepLimit() - h * h / 2.0) < 1e-12);
+    std::cout << "OK" << std::endl;
+}
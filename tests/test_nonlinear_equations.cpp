@@ -1,7 +1,14 @@
 #include <iostream>
 #include <optional>
+#include <vector>
+#include <complex>
+#include <stdexcept>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include <cassert>
 #include <cmath>
+#include <algorithm>
 #include "nonlinear_equations.h"
 
 namespace {
@@ -71,4 +78,491 @@ void TestRegulaFalsiMethodReturnsNullopt() {
     auto result = numeric::nonlinear::regulaFalsiMethod(f_always_pos, -5, 5);
     assert(!result.has_value());
     std::cout << "OK" << std::endl;
-}
\ No newline at end of file
+}
+void TestHybridRootFindersCorrectness() {
+    std::cout << "Test: brentMethod/chandrupatlaMethod/itpMethod - zbieznosc i liczba wywolan... ";
+    using numeric::nonlinear::NonLinearFunction;
+    using Solver = std::optional<numeric::nonlinear::RootResult> (*)(const NonLinearFunction&, double, double, double, int);
+    const Solver solvers[] = { numeric::nonlinear::brentMethod, numeric::nonlinear::chandrupatlaMethod,
+                               numeric::nonlinear::itpMethod };
+    auto cubic = [](double x) { return x * x * x - 2.0 * x - 5.0; };
+    // Plaska funkcja: przez wiekszosc przedzialu |f| ~ 1, interpolacja jest na poczatku bezuzyteczna
+    auto flat = [](double x) { return std::pow(x, 20.0) - 0.5; };
+    for (Solver solve : solvers) {
+        auto parabola = solve(f_parabola, 0.0, 5.0, 1e-12, 100);
+        assert(parabola.has_value());
+        assert(std::abs(parabola->root - 3.0) < 1e-11);
+        // Bisekcja potrzebuje tu okolo 43 wywolan
+        assert(parabola->evaluations <= 15);
+
+        auto cubic_root = solve(cubic, 2.0, 3.0, 1e-12, 100);
+        assert(cubic_root.has_value());
+        assert(std::abs(cubic_root->root - 2.0945514815423265) < 1e-11);
+        assert(cubic_root->evaluations <= 15);
+
+        auto flat_root = solve(flat, 0.0, 1.5, 1e-12, 100);
+        assert(flat_root.has_value());
+        assert(std::abs(flat_root->root - std::pow(0.5, 0.05)) < 1e-11);
+        assert(flat_root->evaluations <= 45);
+
+        // Pierwiastek na koncu przedzialu i brak zmiany znaku
+        auto endpoint = solve(f_parabola, 3.0, 4.0, 1e-12, 100);
+        assert(endpoint.has_value() && endpoint->root == 3.0 && endpoint->evaluations == 2);
+        assert(!solve(f_parabola, 4.0, 10.0, 1e-12, 100).has_value());
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestHybridRootFindersThrowOnInvalidInput() {
+    std::cout << "Test: brentMethod/chandrupatlaMethod/itpMethod - niepoprawne dane... ";
+    using numeric::nonlinear::NonLinearFunction;
+    using Solver = std::optional<numeric::nonlinear::RootResult> (*)(const NonLinearFunction&, double, double, double, int);
+    const Solver solvers[] = { numeric::nonlinear::brentMethod, numeric::nonlinear::chandrupatlaMethod,
+                               numeric::nonlinear::itpMethod };
+    for (Solver solve : solvers) {
+        try {
+            solve(nullptr, 0.0, 5.0, 1e-7, 100);
+            assert(false);
+        } catch (const std::invalid_argument&) {
+        }
+        try {
+            solve(f_parabola, 5.0, 0.0, 1e-7, 100);
+            assert(false);
+        } catch (const std::invalid_argument&) {
+        }
+        try {
+            solve(f_parabola, 0.0, 5.0, 0.0, 100);
+            assert(false);
+        } catch (const std::invalid_argument&) {
+        }
+        try {
+            solve(f_parabola, 0.0, 5.0, 1e-7, 0);
+            assert(false);
+        } catch (const std::invalid_argument&) {
+        }
+        // Za malo iteracji na zadana dokladnosc
+        assert(!solve([](double x) { return std::pow(x, 20.0) - 0.5; }, 0.0, 1.5, 1e-12, 3).has_value());
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestBatchRootFindersCorrectness() {
+    std::cout << "Test: newtonMethodBatch/bisectionMethodBatch/brentMethodBatch - wiele rownan x^3 = p_i... ";
+    const std::size_t count = 1000; // Kilka blokow, ostatni niepelny
+    std::vector<double> p(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        p[i] = 1.0 + 0.05 * static_cast<double>(i);
+    }
+    numeric::nonlinear::BatchRootFunction cubic = [&p](const double* x, double* fx, std::size_t first, std::size_t n) {
+        for (std::size_t m = 0; m < n; ++m) {
+            fx[m] = x[m] * x[m] * x[m] - p[first + m];
+        }
+    };
+    numeric::nonlinear::BatchDerivativeFunction cubic_df =
+        [&p](const double* x, double* fx, double* dfx, std::size_t first, std::size_t n) {
+            for (std::size_t m = 0; m < n; ++m) {
+                fx[m] = x[m] * x[m] * x[m] - p[first + m];
+                dfx[m] = 3.0 * x[m] * x[m];
+            }
+        };
+    std::vector<double> lo(count, 0.0), hi(count, 40.0), x0(count, 5.0);
+    // Problem 7 nie ma zmiany znaku, a Newton startuje w nim z zerowej pochodnej
+    lo[7] = 30.0;
+    x0[7] = 0.0;
+
+    for (int threads : { 1, 3 }) {
+        auto newton = numeric::nonlinear::newtonMethodBatch(cubic_df, x0, 1e-12, 100, threads);
+        auto bisection = numeric::nonlinear::bisectionMethodBatch(cubic, lo, hi, 1e-10, 100, threads);
+        auto brent = numeric::nonlinear::brentMethodBatch(cubic, lo, hi, 1e-12, 100, threads);
+        assert(newton.size() == count && newton.failures() == 1 && !newton.converged[7]);
+        assert(bisection.failures() == 1 && !bisection.converged[7]);
+        assert(brent.failures() == 1 && !brent.converged[7]);
+        std::size_t brent_scalar_evaluations = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (i == 7) {
+                continue;
+            }
+            const double exact = std::cbrt(p[i]);
+            assert(std::abs(newton.roots[i] - exact) < 1e-9);
+            assert(std::abs(bisection.roots[i] - exact) < 1e-8);
+            // Ta sama sekwencja krokow co w wersji skalarnej
+            auto scalar = numeric::nonlinear::brentMethod([&p, i](double x) { return x * x * x - p[i]; },
+                                                          lo[i], hi[i], 1e-12, 100);
+            assert(scalar.has_value());
+            assert(brent.roots[i] == scalar->root && brent.iterations[i] == scalar->iterations);
+            brent_scalar_evaluations += static_cast<std::size_t>(scalar->evaluations);
+        }
+        // Maskowanie kosztuje dodatkowe wartosci f, ale nie zmienia rzedu wielkosci
+        assert(brent.evaluations >= brent_scalar_evaluations && brent.evaluations < 3 * brent_scalar_evaluations);
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestBatchRootFindersThrowOnInvalidInput() {
+    std::cout << "Test: newtonMethodBatch/bisectionMethodBatch/brentMethodBatch - niepoprawne dane... ";
+    numeric::nonlinear::BatchRootFunction f = [](const double* x, double* fx, std::size_t, std::size_t n) {
+        for (std::size_t m = 0; m < n; ++m) fx[m] = x[m];
+    };
+    numeric::nonlinear::BatchDerivativeFunction df = [](const double* x, double* fx, double* dfx, std::size_t, std::size_t n) {
+        for (std::size_t m = 0; m < n; ++m) { fx[m] = x[m]; dfx[m] = 1.0; }
+    };
+    try {
+        numeric::nonlinear::newtonMethodBatch(nullptr, {1.0});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        numeric::nonlinear::newtonMethodBatch(df, {});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        numeric::nonlinear::newtonMethodBatch(df, {1.0}, 1e-7, 100, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        numeric::nonlinear::bisectionMethodBatch(f, {0.0, 0.0}, {1.0});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        numeric::nonlinear::bisectionMethodBatch(f, {1.0}, {0.0});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        numeric::nonlinear::brentMethodBatch(f, {-1.0}, {1.0}, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        numeric::nonlinear::brentMethodBatch(f, {-1.0}, {1.0}, 1e-7, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+
+    // Wyjatek rzucony przez f jest przekazywany wywolujacemu
+    numeric::nonlinear::BatchRootFunction failing = [](const double*, double*, std::size_t, std::size_t) {
+        throw std::runtime_error("blad f");
+    };
+    try {
+        numeric::nonlinear::brentMethodBatch(failing, std::vector<double>(600, -1.0), std::vector<double>(600, 1.0),
+                                             1e-7, 100, 2);
+        assert(false);
+    } catch (const std::runtime_error&) {
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestSolveSystemCorrectness() {
+    std::cout << "Test: solveSystem - Newton i Broyden dla ukladow, przeszukiwanie liniowe... ";
+    using namespace numeric::nonlinear;
+    // Trojdiagonalna funkcja Broydena: (3 - 2 x_i) x_i - x_{i-1} - 2 x_{i+1} + 1 = 0
+    SystemFunction tridiagonal = [](const std::vector<double>& x, std::vector<double>& fx) {
+        const std::size_t n = x.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            const double left = i > 0 ? x[i - 1] : 0.0;
+            const double right = i + 1 < n ? x[i + 1] : 0.0;
+            fx[i] = (3.0 - 2.0 * x[i]) * x[i] - left - 2.0 * right + 1.0;
+        }
+    };
+    const std::vector<double> x0(20, -1.0);
+    SystemSolverOptions newton_options;
+    auto newton = solveSystem(tridiagonal, x0, newton_options);
+    SystemSolverOptions broyden_options;
+    broyden_options.method = SystemMethod::Broyden;
+    auto broyden = solveSystem(tridiagonal, x0, broyden_options);
+    assert(newton.has_value() && broyden.has_value());
+    assert(newton->residual < 1e-10 && broyden->residual < 1e-10);
+    for (std::size_t i = 0; i < x0.size(); ++i) {
+        assert(std::abs(newton->root[i] - broyden->root[i]) < 1e-9);
+    }
+    // Jakobian roznicowy kosztuje n wywolan na iteracje; Broyden liczy go tylko raz
+    assert(newton->jacobian_evaluations == newton->iterations);
+    assert(broyden->jacobian_evaluations == 1 && broyden->factorizations == 1);
+    assert(broyden->function_evaluations * 2 < newton->function_evaluations);
+
+    // Jakobian analityczny: brak dodatkowych wywolan F
+    SystemSolverOptions analytic = newton_options;
+    analytic.jacobian = [](const std::vector<double>& x, std::vector<std::vector<double>>& J) {
+        const std::size_t n = x.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            J[i][i] = 3.0 - 4.0 * x[i];
+            if (i > 0) J[i][i - 1] = -1.0;
+            if (i + 1 < n) J[i][i + 1] = -2.0;
+        }
+    };
+    auto exact = solveSystem(tridiagonal, x0, analytic);
+    assert(exact.has_value());
+    assert(exact->function_evaluations == exact->iterations + 1);
+
+    // atan(x) = 0 z x0 = 3: pelne kroki Newtona rozbiegaja sie, przeszukiwanie liniowe je przycina
+    SystemFunction arctan = [](const std::vector<double>& x, std::vector<double>& fx) { fx[0] = std::atan(x[0]); };
+    auto damped = solveSystem(arctan, {3.0});
+    assert(damped.has_value() && std::abs(damped->root[0]) < 1e-10);
+    SystemSolverOptions undamped;
+    undamped.line_search = false;
+    assert(!solveSystem(arctan, {3.0}, undamped).has_value());
+
+    // Uklad sprzeczny z osobliwym jakobianem
+    SystemFunction singular = [](const std::vector<double>& x, std::vector<double>& fx) {
+        fx[0] = x[0] + x[1] - 1.0;
+        fx[1] = x[0] + x[1] - 2.0;
+    };
+    assert(!solveSystem(singular, {0.0, 0.0}).has_value());
+    std::cout << "OK" << std::endl;
+}
+
+void TestSolveSystemThrowsOnInvalidInput() {
+    std::cout << "Test: solveSystem - niepoprawne dane... ";
+    using namespace numeric::nonlinear;
+    SystemFunction identity = [](const std::vector<double>& x, std::vector<double>& fx) { fx = x; };
+    try {
+        solveSystem(nullptr, {1.0});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        solveSystem(identity, {});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    SystemSolverOptions options;
+    options.tolerance = 0.0;
+    try {
+        solveSystem(identity, {1.0}, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    options = SystemSolverOptions();
+    options.max_iter = 0;
+    try {
+        solveSystem(identity, {1.0}, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestFindAllRootsCorrectness() {
+    std::cout << "Test: findAllRoots - wiele pierwiastkow, pierwiastek podwojny, bliska para... ";
+    using namespace numeric::nonlinear;
+    const double pi = 3.14159265358979323846;
+    for (int threads : { 1, 4 }) {
+        RootSearchOptions options;
+        options.threads = threads;
+
+        // sin x na [0.5, 20]: pierwiastki k * pi, k = 1..6
+        auto sines = findAllRoots([](double x) { return std::sin(x); }, 0.5, 20.0, options);
+        assert(sines.size() == 6);
+        for (std::size_t k = 0; k < sines.size(); ++k) {
+            assert(std::abs(sines[k] - pi * static_cast<double>(k + 1)) < 1e-9);
+        }
+
+        // (x - 1)^2 (x - 2): pierwiastek podwojny bez zmiany znaku i pojedynczy
+        auto cubic = findAllRoots([](double x) { return (x - 1.0) * (x - 1.0) * (x - 2.0); }, 0.0, 3.0, options);
+        assert(cubic.size() == 2);
+        assert(std::abs(cubic[0] - 1.0) < 1e-6 && std::abs(cubic[1] - 2.0) < 1e-9);
+
+        // Para 1 -+ 1e-3 wewnatrz jednego podprzedzialu siatki (h = 0.03) i pierwiastek w wezle siatki
+        auto pair = findAllRoots([](double x) { return ((x - 1.0) * (x - 1.0) - 1e-6) * x; }, 0.0, 30.0, options);
+        assert(pair.size() == 3);
+        assert(pair[0] == 0.0);
+        assert(std::abs(pair[1] - 0.999) < 1e-9 && std::abs(pair[2] - 1.001) < 1e-9);
+
+        options.detect_tangential = false;
+        assert(findAllRoots([](double x) { return (x - 1.0) * (x - 1.0) + 1.0; }, 0.0, 3.0, options).empty());
+        assert(findAllRoots([](double x) { return ((x - 1.0) * (x - 1.0) - 1e-6) * x; }, 0.0, 30.0, options).size() == 1);
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestFindAllRootsThrowsOnInvalidInput() {
+    std::cout << "Test: findAllRoots - niepoprawne dane... ";
+    using namespace numeric::nonlinear;
+    auto f = [](double x) { return x; };
+    try {
+        findAllRoots(nullptr, 0.0, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        findAllRoots(f, 1.0, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    RootSearchOptions options;
+    options.subdivisions = 0;
+    try {
+        findAllRoots(f, 0.0, 1.0, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    options = RootSearchOptions();
+    options.threads = 0;
+    try {
+        findAllRoots(f, 0.0, 1.0, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    options = RootSearchOptions();
+    options.epsilon = -1.0;
+    try {
+        findAllRoots(f, 0.0, 1.0, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestMultisectionMethodCorrectness() {
+    std::cout << "Test: multisectionMethod - mniej rund niz bisekcja, rownolegle wywolania f... ";
+    using numeric::nonlinear::multisectionMethod;
+    // Bisekcja: ~36 rund dla 1e-10 na [0, 5]; osmiopodzial: log8(5e10) ~ 12
+    auto halving = multisectionMethod(f_parabola, 0.0, 5.0, 2, 1e-10, 100);
+    auto eighths = multisectionMethod(f_parabola, 0.0, 5.0, 8, 1e-10, 100, 7);
+    assert(halving.has_value() && eighths.has_value());
+    assert(std::abs(halving->root - 3.0) < 1e-9 && std::abs(eighths->root - 3.0) < 1e-9);
+    assert(halving->iterations >= 30);
+    assert(eighths->iterations <= 13);
+    assert(eighths->evaluations == 2 + 7 * eighths->iterations);
+
+    // Kosztowna f: wywolania w jednej rundzie nakladaja sie w czasie
+    std::atomic<int> running{0}, max_running{0};
+    auto slow = [&](double x) {
+        int now = ++running;
+        int seen = max_running.load();
+        while (now > seen && !max_running.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        --running;
+        return x * x - 9.0;
+    };
+    auto parallel_root = multisectionMethod(slow, 0.0, 5.0, 5, 1e-6, 100, 4);
+    assert(parallel_root.has_value() && std::abs(parallel_root->root - 3.0) < 1e-6);
+    assert(max_running.load() > 1);
+
+    assert(!multisectionMethod(f_parabola, 4.0, 10.0, 4).has_value());
+    assert(!multisectionMethod(f_parabola, 0.0, 5.0, 4, 1e-12, 3).has_value());
+    std::cout << "OK" << std::endl;
+}
+
+void TestMultisectionMethodThrowsOnInvalidInput() {
+    std::cout << "Test: multisectionMethod - niepoprawne dane... ";
+    using numeric::nonlinear::multisectionMethod;
+    try {
+        multisectionMethod(nullptr, 0.0, 5.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        multisectionMethod(f_parabola, 5.0, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        multisectionMethod(f_parabola, 0.0, 5.0, 1);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        multisectionMethod(f_parabola, 0.0, 5.0, 4, 0.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        multisectionMethod(f_parabola, 0.0, 5.0, 4, 1e-7, 100, 0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestPolynomialRootsCorrectness() {
+    std::cout << "Test: polynomialRoots - Aberth-Ehrlich, macierz stowarzyszona, wysoki stopien... ";
+    using numeric::nonlinear::polynomialRoots;
+    using numeric::nonlinear::PolynomialRootOptions;
+    // (x - 1)(x - 2)(x - 3) = -6 + 11x - 6x^2 + x^3
+    auto cubic = polynomialRoots({ -6.0, 11.0, -6.0, 1.0 });
+    assert(cubic.converged && !cubic.used_companion && cubic.roots.size() == 3);
+    for (std::size_t k = 0; k < 3; ++k) {
+        assert(std::abs(cubic.roots[k] - std::complex<double>(static_cast<double>(k + 1), 0.0)) < 1e-12);
+        assert(cubic.roots[k].imag() == 0.0);
+    }
+
+    // x^2 + 1: para sprzezona; x^3 - x^2 = x^2 (x - 1): zera z najnizszych wspolczynnikow; zerowy wspolczynnik x^3
+    auto conjugate = polynomialRoots({ 1.0, 0.0, 1.0 });
+    assert(std::abs(conjugate.roots[0] - std::complex<double>(0.0, -1.0)) < 1e-14);
+    assert(std::abs(conjugate.roots[1] - std::complex<double>(0.0, 1.0)) < 1e-14);
+    auto zeros = polynomialRoots({ 0.0, 0.0, -1.0, 1.0 });
+    assert(zeros.roots.size() == 3 && zeros.roots[0] == 0.0 && zeros.roots[1] == 0.0);
+    assert(std::abs(zeros.roots[2] - 1.0) < 1e-14);
+    auto linear = polynomialRoots({ 1.0, 1.0, 0.0 });
+    assert(linear.roots.size() == 1 && std::abs(linear.roots[0] + 1.0) < 1e-15);
+
+    // x^1000 - 1: pierwiastki z jednosci; bez postaci odwroconej z^1000 przepelnialoby sie przy |z| > 2
+    std::vector<double> unity(1001, 0.0);
+    unity[0] = -1.0;
+    unity[1000] = 1.0;
+    PolynomialRootOptions parallel_options;
+    parallel_options.threads = 4;
+    auto circle = polynomialRoots(unity, parallel_options);
+    assert(circle.converged && !circle.used_companion && circle.roots.size() == 1000);
+    for (std::size_t k = 0; k < circle.roots.size(); ++k) {
+        assert(std::abs(std::abs(circle.roots[k]) - 1.0) < 1e-14);
+        if (k > 0) {
+            assert(std::abs(circle.roots[k] - circle.roots[k - 1]) > 1e-4); // Brak zbieglych do siebie przyblizen
+        }
+    }
+
+    // Zbyt malo iteracji: wynik z wartosci wlasnych macierzy stowarzyszonej
+    PolynomialRootOptions fallback;
+    fallback.max_iter = 1;
+    auto companion = polynomialRoots({ 2.0, -3.0, 4.0, -1.0, 5.0, 1.0 }, fallback);
+    auto aberth = polynomialRoots({ 2.0, -3.0, 4.0, -1.0, 5.0, 1.0 });
+    assert(companion.used_companion && companion.converged && aberth.converged);
+    assert(companion.roots.size() == 5);
+    // Porzadek w parze sprzezonej zalezy od ostatnich bitow czesci rzeczywistej, wiec porownujemy z najblizszym
+    for (const auto& root : companion.roots) {
+        double nearest = 1e300;
+        for (const auto& other : aberth.roots) {
+            nearest = std::min(nearest, std::abs(root - other));
+        }
+        assert(nearest < 1e-10);
+    }
+    std::cout << "OK" << std::endl;
+}
+
+void TestPolynomialRootsThrowsOnInvalidInput() {
+    std::cout << "Test: polynomialRoots - niepoprawne dane... ";
+    using numeric::nonlinear::polynomialRoots;
+    using numeric::nonlinear::PolynomialRootOptions;
+    try {
+        polynomialRoots({});
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    try {
+        polynomialRoots({ 0.0, 0.0 });
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    PolynomialRootOptions options;
+    options.epsilon = 0.0;
+    try {
+        polynomialRoots({ 1.0, 1.0 }, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    options = PolynomialRootOptions();
+    options.threads = 0;
+    try {
+        polynomialRoots({ 1.0, 1.0 }, options);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    // Wielomian staly nie ma pierwiastkow
+    assert(polynomialRoots({ 3.0 }).roots.empty());
+    std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,108 @@
+// tests/test_stiff_equations.cpp
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <algorithm>
+#include "stiff_equations.h"
+
+namespace {
+    void assertDoubleEqual(double a, double b, double tolerance = 1e-5) {
+        assert(std::abs(a - b) < tolerance);
+    }
+    // Sztywne rownanie y' = -1000 (y - cos x) - sin x, y(0) = 1, rozwiazanie y = cos x.
+    // Metody jawne wymagaja h < ~0.003; tu uzywamy h = 0.05.
+    numeric::ode::OdeSystemFunction f_stiff = [](double x, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = -1000.0 * (y[0] - std::cos(x)) - std::sin(x);
+    };
+}
+
+void TestBdfSystemCorrectness() {
+    std::cout << "Test: bdfSystem - sztywne rownanie z duzym krokiem... ";
+    auto result = numeric::ode::bdfSystem(f_stiff, 0.0, {1.0}, 0.05, 5.0, 5);
+    assert(result.has_value());
+    const auto& traj = result->trajectory;
+    assert(traj.size() == 101);
+    assertDoubleEqual(traj.state(traj.size() - 1)[0], std::cos(5.0), 1e-4);
+    // Macierz iteracji jest rozkladana tylko przy zmianach rzedu, a jakobian liczony raz (problem liniowy)
+    assert(result->jacobian_evaluations == 1);
+    const auto& orders = result->orders;
+    assert(orders.size() == 100 && orders.front() == 1);
+    int order_changes = 0;
+    for (std::size_t i = 1; i < orders.size(); ++i) {
+        assert(std::abs(orders[i] - orders[i - 1]) <= 1);
+        order_changes += (orders[i] != orders[i - 1]) ? 1 : 0;
+    }
+    assert(result->factorizations == 1 + order_changes);
+    assert(*std::max_element(orders.begin(), orders.end()) == 5);
+
+    // Stan przejsciowy (y0 = 2 lezy daleko od rozwiazania wolnego): rzad rosnie pozniej
+    auto transient = numeric::ode::bdfSystem(f_stiff, 0.0, {2.0}, 0.05, 5.0, 5);
+    assert(transient.has_value());
+    auto first_at = [](const std::vector<int>& o, int order) {
+        return std::find(o.begin(), o.end(), order) - o.begin();
+    };
+    assert(first_at(transient->orders, 2) > first_at(orders, 2));
+    assertDoubleEqual(transient->trajectory.y.back(), std::cos(5.0), 1e-4);
+    // Wyzszy dopuszczalny rzad daje mniejszy blad przy tym samym kroku
+    auto low_order = numeric::ode::bdfSystem(f_stiff, 0.0, {1.0}, 0.05, 5.0, 2);
+    assert(*std::max_element(low_order->orders.begin(), low_order->orders.end()) == 2);
+    assert(std::abs(traj.y.back() - std::cos(5.0)) < 0.01 * std::abs(low_order->trajectory.y.back() - std::cos(5.0)));
+
+    // Jakobian uzytkownika
+    numeric::ode::StiffOptions options;
+    options.jacobian = [](double, const std::vector<double>&, std::vector<std::vector<double>>& J) { J[0][0] = -1000.0; };
+    auto with_jacobian = numeric::ode::bdfSystem(f_stiff, 0.0, {1.0}, 0.05, 5.0, 2, options);
+    assert(with_jacobian.has_value());
+    assertDoubleEqual(with_jacobian->trajectory.y.back(), std::cos(5.0), 1e-4);
+    std::cout << "OK" << std::endl;
+}
+
+void TestBdfSystemThrowsOnInvalidInput() {
+    std::cout << "Test: bdfSystem - niepoprawny rzad... ";
+    try {
+        numeric::ode::bdfSystem(f_stiff, 0.0, {1.0}, 0.05, 1.0, 6);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+    }
+    // Wyjatek z funkcji uzytkownika nie moze byc zamieniony na "osobliwa macierz" (pusty wynik)
+    numeric::ode::OdeSystemFunction f_throwing = [](double, const std::vector<double>&, std::vector<double>&) {
+        throw std::runtime_error("blad modelu");
+    };
+    try {
+        numeric::ode::bdfSystem(f_throwing, 0.0, {1.0}, 0.05, 1.0, 2);
+        assert(false);
+    } catch (const std::runtime_error&) {
+        std::cout << "OK" << std::endl;
+    }
+}
+
+void TestRosenbrockSystemCorrectness() {
+    std::cout << "Test: rosenbrockSystem - sztywny uklad z duzym krokiem... ";
+    // Uklad liniowy o wartosciach wlasnych -1 i -10000; y1 -> e^{-x}
+    numeric::ode::OdeSystemFunction f_system = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = -y[0];
+        dydx[1] = -10000.0 * (y[1] - y[0]) - y[0];
+    };
+    numeric::ode::StiffOptions options;
+    options.jacobian_reuse = 50;
+    auto result = numeric::ode::rosenbrockSystem(f_system, 0.0, {1.0, 1.0}, 0.01, 2.0, options);
+    assert(result.has_value());
+    const auto& traj = result->trajectory;
+    assertDoubleEqual(traj.state(traj.size() - 1)[0], std::exp(-2.0), 1e-4);
+    assertDoubleEqual(traj.state(traj.size() - 1)[1], std::exp(-2.0), 1e-4);
+    assert(result->jacobian_evaluations == 4);
+    std::cout << "OK" << std::endl;
+}
+
+void TestRosenbrockSystemThrowsOnInvalidInput() {
+    std::cout << "Test: rosenbrockSystem - niepoprawny krok... ";
+    try {
+        numeric::ode::rosenbrockSystem(f_stiff, 0.0, {1.0}, -0.1, 1.0);
+        assert(false);
+    } catch (const std::invalid_argument&) {
+        std::cout << "OK" << std::endl;
+    }
+}
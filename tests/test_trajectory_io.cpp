@@ -0,0 +1,191 @@
+// tests/test_trajectory_io.cpp
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include "trajectory_io.h"
+
+namespace {
+    void assertDoubleEqual(double a, double b, double tolerance = 1e-9) {
+        assert(std::abs(a - b) < tolerance);
+    }
+
+    std::string temporaryPath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    numeric::ode::OdeSystemFunction oscillator = [](double, const std::vector<double>& y, std::vector<double>& dydx) {
+        dydx[0] = y[1];
+        dydx[1] = -y[0];
+    };
+}
+
+void TestTrajectoryIoRoundTrip() {
+    std::cout << "Test: TrajectoryWriter/TrajectoryReader - zapis z solvera i odczyt przez mmap... ";
+    using namespace numeric::ode;
+    const std::string path = temporaryPath("numcpplib_trajectory_f64.bin");
+    {
+        std::ofstream out(path, std::ios::binary);
+        TrajectoryWriter writer(out, 2, StoragePrecision::Float64, 7);
+        rungeKutta4System(oscillator, 0.0, {0.0, 1.0}, 0.1, 5.0, writer.observer());
+        writer.finish();
+        assert(writer.rows() == 51);
+    }
+    auto expected = rungeKutta4System(oscillator, 0.0, {0.0, 1.0}, 0.1, 5.0);
+    {
+        TrajectoryReader reader(path);
+        assert(reader.dimension() == 2 && reader.rows() == 51);
+        assert(reader.chunkCount() == 8 && reader.chunkRows(7) == 2);
+        assert(reader.precision() == StoragePrecision::Float64);
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            assert(reader.x(i) == expected.x[i]);
+            assert(reader.state(i, 0) == expected.state(i)[0]);
+            assert(reader.state(i, 1) == expected.state(i)[1]);
+        }
+        // Kolumny bez kopiowania i wyszukiwanie porcji po x
+        std::size_t chunk = reader.findChunk(2.05);
+        assert(chunk == 2);
+        const double* xs = reader.xColumn<double>(chunk);
+        const double* velocity = reader.stateColumn<double>(chunk, 1);
+        assert(xs[0] == expected.x[14] && velocity[6] == expected.state(20)[1]);
+        assert(reader.component(0).size() == 51 && reader.xValues().back() == expected.x.back());
+    }
+    std::filesystem::remove(path);
+
+    // Precyzja float32 i obserwator skalarny
+    const std::string path32 = temporaryPath("numcpplib_trajectory_f32.bin");
+    {
+        std::ofstream out(path32, std::ios::binary);
+        TrajectoryWriter writer(out, 1, StoragePrecision::Float32, 16);
+        rungeKutta4([](double, double y) { return y; }, 0.0, 1.0, 1.0 / 64.0, 1.0, writer.scalarObserver());
+    } // finish() w destruktorze
+    {
+        TrajectoryReader reader(path32);
+        assert(reader.rows() == 65 && reader.precision() == StoragePrecision::Float32);
+        assertDoubleEqual(reader.state(64, 0), std::exp(1.0), 1e-6);
+        // x pozostaje w double, stan jest w float
+        assert(reader.xColumn<double>(0)[1] == 1.0 / 64.0);
+        assert(static_cast<double>(reader.stateColumn<float>(4, 0)[0]) == reader.state(64, 0));
+    }
+    std::filesystem::remove(path32);
+
+    // Dlugi przebieg w float32: x = 1e6 + 0.01 i nie moze sie powtarzac, a indeks zgadza sie z kolumna x
+    {
+        std::ofstream out(path32, std::ios::binary);
+        TrajectoryWriter writer(out, 3, StoragePrecision::Float32, 5); // 5 wierszy: porcje wymagaja wyrownania
+        for (int i = 0; i < 23; ++i) {
+            writer.append(1e6 + 0.01 * i, { 1.0, 2.0, 3.0 * i });
+        }
+    }
+    {
+        TrajectoryReader reader(path32);
+        std::vector<double> xs = reader.xValues();
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            assert(xs[i] == 1e6 + 0.01 * static_cast<double>(i));
+        }
+        for (std::size_t c = 0; c < reader.chunkCount(); ++c) {
+            assert(reader.chunkFirstX(c) == reader.xColumn<double>(c)[0]);
+            assert(reader.chunkLastX(c) == reader.xColumn<double>(c)[reader.chunkRows(c) - 1]);
+        }
+        assert(reader.state(22, 2) == 66.0 && reader.findChunk(1e6 + 0.105) == 2);
+    }
+    std::filesystem::remove(path32);
+
+    std::cout << "OK" << std::endl;
+}
+
+void TestTrajectoryIoThrowsOnInvalidInput() {
+    std::cout << "Test: TrajectoryReader - plik w nieprawidlowym formacie... ";
+    const std::string path = temporaryPath("numcpplib_trajectory_bad.bin");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "to nie jest trajektoria, tylko zwykly tekst o dlugosci wiekszej niz naglowek i stopka razem";
+    }
+    try {
+        numeric::ode::TrajectoryReader reader(path);
+        assert(false);
+    } catch (const std::runtime_error&) {
+    }
+
+    // Uszkodzone pola naglowka i indeksu dobrane tak, by nieograniczone mnozenie uint64_t przepelnilo sie
+    // i przeszlo kontrole rozmiaru
+    std::vector<char> valid;
+    {
+        std::ostringstream out(std::ios::binary);
+        numeric::ode::TrajectoryWriter writer(out, 2, numeric::ode::StoragePrecision::Float64, 4);
+        for (int i = 0; i < 10; ++i) {
+            writer.append(0.1 * i, { 1.0 * i, 2.0 * i });
+        }
+        writer.finish();
+        const std::string bytes = out.str();
+        valid.assign(bytes.begin(), bytes.end());
+    }
+    const std::size_t footer = valid.size() - 24;
+    std::uint64_t index_offset;
+    std::memcpy(&index_offset, valid.data() + footer, 8);
+    auto expectCorrupted = [&](const std::vector<char>& bytes) {
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+        try {
+            numeric::ode::TrajectoryReader reader(path);
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+    };
+    auto patched = [&](std::size_t position, std::uint64_t value) {
+        std::vector<char> bytes = valid;
+        std::memcpy(bytes.data() + position, &value, 8);
+        return bytes;
+    };
+    expectCorrupted(patched(16, (std::uint64_t(1) << 61) + 2));               // Wymiar: (d + 1) * 8 zawija sie
+    std::uint64_t chunk_count;
+    std::memcpy(&chunk_count, valid.data() + footer + 8, 8);
+    expectCorrupted(patched(footer + 8, chunk_count + (std::uint64_t(1) << 59))); // Liczba porcji * 32 zawija sie
+    expectCorrupted(patched(static_cast<std::size_t>(index_offset), 0));         // Porcja wewnatrz naglowka
+    expectCorrupted(patched(static_cast<std::size_t>(index_offset) + 32, index_offset)); // Porcja za danymi
+    expectCorrupted(patched(footer, 8));                                         // Indeks wewnatrz naglowka
+    std::vector<char> truncated(valid.begin(), valid.begin() + static_cast<std::ptrdiff_t>(index_offset) + 40);
+    truncated.insert(truncated.end(), valid.end() - 24, valid.end());          // Obciety indeks z poprawna stopka
+    expectCorrupted(truncated);
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(valid.data(), static_cast<std::streamsize>(valid.size()));
+    }
+    assert(numeric::ode::TrajectoryReader(path).rows() == 10);
+    std::filesystem::remove(path);
+
+    // Blad zapisu porcji przelacza writer w stan bledu: dalsze append() i finish() nie moga pisac poza bufory
+    {
+        std::ostringstream out(std::ios::binary);
+        numeric::ode::TrajectoryWriter writer(out, 2, numeric::ode::StoragePrecision::Float64, 4);
+        out.setstate(std::ios::badbit);
+        for (int i = 0; i < 3; ++i) {
+            writer.append(0.1 * i, { 1.0, 2.0 });
+        }
+        try {
+            writer.append(0.3, { 1.0, 2.0 }); // Pelna porcja - zapis do strumienia z badbit
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+        try {
+            writer.append(0.4, { 1.0, 2.0 });
+            assert(false);
+        } catch (const std::logic_error&) {
+        }
+        try {
+            writer.finish();
+            assert(false);
+        } catch (const std::logic_error&) {
+        }
+    }
+    std::cout << "OK" << std::endl;
+}